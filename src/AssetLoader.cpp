@@ -0,0 +1,99 @@
+// src/AssetLoader.cpp
+#include "AssetLoader.h"
+
+#include <algorithm>
+#include <utility>
+
+AssetLoader::AssetLoader(int threads) {
+  m_wakeEvent = SDL_RegisterEvents(1);
+
+  if (threads <= 0) threads = std::min((int)Asset::Count, SDL_GetCPUCount());
+  threads = std::max(1, threads);
+
+  for (int i = 0; i < threads; i++) {
+    m_workers.emplace_back([this] { workerLoop(); });
+  }
+}
+
+AssetLoader::~AssetLoader() {
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_queue.clear(); // not started: nothing to wait for
+    m_quit = true;
+  }
+  m_wake.notify_all();
+  for (std::thread& t : m_workers) t.join();
+}
+
+void AssetLoader::start(Asset asset, Work work, Finish finish) {
+  m_state[(size_t)asset] = State::Loading;
+
+  Job job;
+  job.asset = asset;
+  job.work = std::move(work);
+  job.finish = std::move(finish);
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_queue.push_back(std::move(job));
+  }
+  m_wake.notify_one();
+}
+
+void AssetLoader::workerLoop() {
+  for (;;) {
+    Job job;
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [&] { return m_quit || !m_queue.empty(); });
+      if (m_quit) return;
+      job = std::move(m_queue.front());
+      m_queue.pop_front();
+      m_running++;
+    }
+
+    job.ok = job.work ? job.work() : true;
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_finished.push_back(std::move(job));
+      m_running--;
+    }
+    m_done.notify_all();
+
+    if (m_wakeEvent != (Uint32)-1) {
+      SDL_Event e{};
+      e.type = m_wakeEvent;
+      SDL_PushEvent(&e); // thread-safe; fails harmlessly without events
+    }
+  }
+}
+
+bool AssetLoader::poll() {
+  std::vector<Job> finished;
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    if (m_finished.empty()) return false;
+    finished.swap(m_finished);
+  }
+
+  for (Job& job : finished) {
+    if (job.finish) job.finish(job.ok);
+    m_state[(size_t)job.asset] = job.ok ? State::Ready : State::Failed;
+  }
+  return true;
+}
+
+void AssetLoader::wait() {
+  {
+    std::unique_lock<std::mutex> lock(m_mutex);
+    m_done.wait(lock, [&] { return m_queue.empty() && m_running == 0; });
+  }
+  poll();
+}
+
+bool AssetLoader::busy() const {
+  for (State s : m_state) {
+    if (s == State::Loading) return true;
+  }
+  return false;
+}
@@ -0,0 +1,76 @@
+// src/AssetLoader.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <condition_variable>
+#include <cstdint>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Startup assets decoded on worker threads while the window is already up.
+//
+// A job is split in two: `work` runs on a loader thread and may only touch
+// CPU-side data it owns until it finishes (file bytes, decoded pixels, a
+// distance field); `finish` runs on the main thread from poll(), where the
+// renderer and the TextureRegistry live, and publishes the result. An asset
+// is ready() once its finish step has run, so scenes poll readiness and draw
+// what they have in the meantime. A finished job posts wakeEvent() so a
+// main loop blocked in SDL_WaitEvent gets round to poll().
+class AssetLoader {
+public:
+  enum class Asset : uint8_t {
+    Fonts,   // FontCache, SDL_ttf and the SDF font belong to the loader until ready
+    Sprites, // SpriteAtlas pages
+    Count
+  };
+
+  using Work = std::function<bool()>;          // loader thread; false = failed
+  using Finish = std::function<void(bool ok)>; // main thread
+
+  explicit AssetLoader(int threads = 0); // 0 = one per asset, capped by cores
+  ~AssetLoader();                        // waits for running jobs
+
+  AssetLoader(const AssetLoader&) = delete;
+  AssetLoader& operator=(const AssetLoader&) = delete;
+
+  void start(Asset asset, Work work, Finish finish = nullptr);
+
+  // Run the finish steps of completed jobs; true if anything became ready
+  bool poll();
+
+  // Block until every started job is done, then poll()
+  void wait();
+
+  bool ready(Asset asset) const { return m_state[(size_t)asset] == State::Ready; }
+  bool failed(Asset asset) const { return m_state[(size_t)asset] == State::Failed; }
+  bool busy() const; // some asset is still loading
+
+  Uint32 wakeEvent() const { return m_wakeEvent; } // (Uint32)-1 if none
+
+private:
+  enum class State : uint8_t { Idle, Loading, Ready, Failed };
+
+  struct Job {
+    Asset  asset = Asset::Fonts;
+    Work   work;
+    Finish finish;
+    bool   ok = false;
+  };
+
+  void workerLoop();
+
+  State  m_state[(size_t)Asset::Count] = {}; // main thread only
+  Uint32 m_wakeEvent = (Uint32)-1;
+
+  std::vector<std::thread> m_workers;
+  std::mutex               m_mutex;
+  std::condition_variable  m_wake;
+  std::condition_variable  m_done;
+  std::deque<Job>          m_queue;    // waiting for a worker
+  std::vector<Job>         m_finished; // waiting for poll()
+  int                      m_running = 0;
+  bool                     m_quit = false;
+};
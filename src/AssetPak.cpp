@@ -0,0 +1,122 @@
+// src/AssetPak.cpp
+#include "AssetPak.h"
+
+#include <SDL2/SDL.h>
+#include <cstdio>
+#include <cstring>
+
+#ifndef _WIN32
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+static uint32_t le32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+static uint64_t le64(const uint8_t* p) {
+  return (uint64_t)le32(p) | ((uint64_t)le32(p + 4) << 32);
+}
+
+uint64_t AssetPak::hashName(const char* name, size_t len) {
+  uint64_t h = 1469598103934665603ull; // FNV-1a
+  for (size_t i = 0; i < len; i++) {
+    h ^= (uint8_t)name[i];
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+bool AssetPak::open(const char* path) {
+  close();
+  if (!path) return false;
+
+#ifndef _WIN32
+  const int fd = ::open(path, O_RDONLY);
+  if (fd < 0) return false; // no archive: not an error
+  struct stat st{};
+  void* map = MAP_FAILED;
+  if (fstat(fd, &st) == 0 && st.st_size > 0) {
+    map = mmap(nullptr, (size_t)st.st_size, PROT_READ, MAP_PRIVATE, fd, 0);
+  }
+  ::close(fd); // the mapping keeps the file referenced
+  if (map == MAP_FAILED) {
+    std::printf("AssetPak: cannot map %s\n", path);
+    return false;
+  }
+  m_base = (const uint8_t*)map;
+  m_size = (size_t)st.st_size;
+  m_mapped = true;
+#else
+  // No mmap here: read it whole instead
+  size_t size = 0;
+  void* data = SDL_LoadFile(path, &size);
+  if (!data) return false;
+  m_base = (const uint8_t*)data;
+  m_size = size;
+#endif
+
+  // Check everything find() relies on once, up front
+  bool ok = m_size >= HEADER_SIZE && std::memcmp(m_base, "GPAK", 4) == 0 &&
+            le32(m_base + 4) == VERSION && le64(m_base + 24) == m_size;
+  if (ok) {
+    m_count = le32(m_base + 8);
+    m_names = le64(m_base + 16);
+    ok = m_names >= HEADER_SIZE + (uint64_t)m_count * ENTRY_SIZE && m_names <= m_size;
+  }
+  for (uint32_t i = 0; ok && i < m_count; i++) {
+    const uint8_t* e = m_base + HEADER_SIZE + (size_t)i * ENTRY_SIZE;
+    const uint64_t offset = le64(e + 8), size = le64(e + 16);
+    ok = offset <= m_size && size <= m_size - offset &&
+         m_names + le32(e + 24) + le32(e + 28) <= m_size;
+  }
+  if (!ok) {
+    std::printf("AssetPak: %s is not a valid version %u archive\n", path, (unsigned)VERSION);
+    close();
+    return false;
+  }
+  return true;
+}
+
+void AssetPak::close() {
+  if (m_base) {
+#ifndef _WIN32
+    if (m_mapped) munmap((void*)m_base, m_size);
+#endif
+    if (!m_mapped) SDL_free((void*)m_base);
+  }
+  m_base = nullptr;
+  m_size = 0;
+  m_count = 0;
+  m_names = 0;
+  m_mapped = false;
+}
+
+bool AssetPak::find(const char* name, const uint8_t*& data, size_t& size) const {
+  if (!m_base || !name) return false;
+
+  const size_t len = std::strlen(name);
+  const uint64_t hash = hashName(name, len);
+  const uint8_t* index = m_base + HEADER_SIZE;
+
+  // First entry with this hash; colliding names sit next to each other
+  uint32_t lo = 0, hi = m_count;
+  while (lo < hi) {
+    const uint32_t mid = lo + (hi - lo) / 2;
+    if (le64(index + (size_t)mid * ENTRY_SIZE) < hash) lo = mid + 1;
+    else hi = mid;
+  }
+
+  for (uint32_t i = lo; i < m_count; i++) {
+    const uint8_t* e = index + (size_t)i * ENTRY_SIZE;
+    if (le64(e) != hash) break;
+    if (le32(e + 28) != len || std::memcmp(m_base + m_names + le32(e + 24), name, len) != 0) continue;
+
+    data = m_base + le64(e + 8);
+    size = (size_t)le64(e + 16);
+    return true;
+  }
+  return false;
+}
@@ -0,0 +1,52 @@
+// src/AssetPak.h
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+
+// Read-only view of an assets.pak archive (written by tools/asset_pak.cpp).
+//
+// The whole file is memory-mapped by open(), so startup I/O is one mapping
+// and pages fault in as assets are actually read. find() binary searches
+// the name-hash index and returns a pointer into the mapping: no copy, and
+// valid until close().
+//
+// Layout (little endian):
+//   header, 32 bytes:  "GPAK", u32 version, u32 count, u32 alignment,
+//                      u64 names offset, u64 file size
+//   index, count x 32: u64 FNV-1a hash of the name, u64 payload offset,
+//                      u64 payload size, u32 name offset, u32 name length;
+//                      sorted by (hash, name)
+//   names:             the names back to back (no terminators)
+//   payloads:          each at a multiple of `alignment`
+class AssetPak {
+public:
+  static constexpr uint32_t VERSION = 1;
+  static constexpr size_t HEADER_SIZE = 32;
+  static constexpr size_t ENTRY_SIZE = 32;
+
+  AssetPak() = default;
+  ~AssetPak() { close(); }
+
+  AssetPak(const AssetPak&) = delete;
+  AssetPak& operator=(const AssetPak&) = delete;
+
+  // false (with a message unless the file is simply missing) if `path`
+  // isn't a valid archive
+  bool open(const char* path);
+  void close();
+  bool isOpen() const { return m_base != nullptr; }
+
+  bool find(const char* name, const uint8_t*& data, size_t& size) const;
+
+  int count() const { return (int)m_count; }
+
+  static uint64_t hashName(const char* name, size_t len);
+
+private:
+  const uint8_t* m_base = nullptr;
+  size_t   m_size = 0;
+  uint32_t m_count = 0;
+  uint64_t m_names = 0;
+  bool     m_mapped = false; // false: SDL_LoadFile buffer
+};
@@ -0,0 +1,93 @@
+// src/Assets.cpp
+#include "Assets.h"
+
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+
+#include "AssetPak.h"
+#include "EmbeddedAssets.h" // table generated by the embedded_assets target
+
+static AssetPak g_pak; // unmapped at exit
+
+AssetView::~AssetView() {
+  if (m_owned) SDL_free(m_owned);
+}
+
+AssetView::AssetView(AssetView&& o) noexcept
+  : m_data(o.m_data), m_size(o.m_size), m_owned(o.m_owned) {
+  o.m_data = nullptr;
+  o.m_size = 0;
+  o.m_owned = nullptr;
+}
+
+AssetView& AssetView::operator=(AssetView&& o) noexcept {
+  if (this != &o) {
+    if (m_owned) SDL_free(m_owned);
+    m_data = o.m_data;
+    m_size = o.m_size;
+    m_owned = o.m_owned;
+    o.m_data = nullptr;
+    o.m_size = 0;
+    o.m_owned = nullptr;
+  }
+  return *this;
+}
+
+SDL_RWops* AssetView::rw() const {
+  if (!m_data) return nullptr;
+  return SDL_RWFromConstMem(m_data, (int)m_size);
+}
+
+bool mountAssetPak(const char* path) {
+  std::string fallback;
+  if (!path) path = SDL_getenv("GAME_ASSET_PAK");
+  if (!path || !path[0]) {
+    // Built with the assets embedded: an assets.pak lying next to the
+    // binary is most likely stale (an earlier build), so don't let it win.
+    if (embedded::FILE_COUNT > 0) return false;
+
+    char* base = SDL_GetBasePath();
+    fallback = std::string(base ? base : "") + "assets.pak";
+    if (base) SDL_free(base);
+    path = fallback.c_str();
+  }
+
+  if (!g_pak.open(path)) return false;
+  std::printf("Assets: mapped %s (%d files)\n", path, g_pak.count());
+  return true;
+}
+
+AssetView openAsset(const char* name) {
+  AssetView view;
+  if (!name) return view;
+
+  // GAME_ASSET_DIR=<dir>: loose files there take precedence
+  const char* dir = SDL_getenv("GAME_ASSET_DIR");
+  if (dir && dir[0]) {
+    const std::string path = std::string(dir) + "/" + name;
+    size_t size = 0;
+    if (void* data = SDL_LoadFile(path.c_str(), &size)) {
+      view.m_owned = data;
+      view.m_data = (const uint8_t*)data;
+      view.m_size = size;
+      return view;
+    }
+  }
+
+  if (g_pak.find(name, view.m_data, view.m_size)) return view;
+
+  const embedded::File* begin = embedded::FILES;
+  const embedded::File* end = embedded::FILES + embedded::FILE_COUNT;
+  const embedded::File* it = std::lower_bound(begin, end, name,
+    [](const embedded::File& f, const char* n) { return std::strcmp(f.name, n) < 0; });
+  if (it == end || std::strcmp(it->name, name) != 0) {
+    std::printf("openAsset: %s not found\n", name);
+    return view;
+  }
+
+  view.m_data = it->data;
+  view.m_size = it->size;
+  return view;
+}
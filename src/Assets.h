@@ -0,0 +1,53 @@
+// src/Assets.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <cstddef>
+#include <cstdint>
+
+// Read-only game data by name, e.g. "fonts/DejaVuSans.ttf".
+//
+// Names are looked up, in order, in:
+//  1. GAME_ASSET_DIR, a directory of loose files for development (a font
+//     or atlas page can change without rebuilding); read into memory the
+//     view owns.
+//  2. The archive mounted by mountAssetPak() (assets.pak, see AssetPak.h),
+//     memory-mapped once.
+//  3. The files compiled into the executable (tools/embed_assets.cpp;
+//     CMake option GAME_EMBED_ASSETS).
+// Views of 2 and 3 point straight into the mapping or the binary and rw()
+// wraps them with SDL_RWFromConstMem, so nothing is copied.
+class AssetView {
+public:
+  AssetView() = default;
+  ~AssetView();
+
+  AssetView(AssetView&& o) noexcept;
+  AssetView& operator=(AssetView&& o) noexcept;
+  AssetView(const AssetView&) = delete;
+  AssetView& operator=(const AssetView&) = delete;
+
+  const uint8_t* data() const { return m_data; }
+  size_t size() const { return m_size; }
+  explicit operator bool() const { return m_data != nullptr; }
+
+  // Read-only stream over the bytes (nullptr if empty). The view must
+  // outlive it; SDL_RWclose (or an SDL loader's freesrc) closes it.
+  SDL_RWops* rw() const;
+
+private:
+  friend AssetView openAsset(const char* name);
+
+  const uint8_t* m_data = nullptr;
+  size_t         m_size = 0;
+  void*          m_owned = nullptr; // SDL_LoadFile buffer of an override
+};
+
+// Map `path`, or by default GAME_ASSET_PAK, or assets.pak next to the
+// executable when nothing is embedded (GAME_EMBED_ASSETS=OFF). Call once at
+// startup, before any loader thread runs; false if there is no (valid)
+// archive, which is fine when assets are embedded.
+bool mountAssetPak(const char* path = nullptr);
+
+// Empty view (and a message) if `name` is found nowhere. Thread-safe.
+AssetView openAsset(const char* name);
@@ -0,0 +1,50 @@
+// src/DynamicResolution.cpp
+#include "DynamicResolution.h"
+
+#include <algorithm>
+#include <cmath>
+
+// Scales are multiples of this, so the render size only changes in steps
+static constexpr float SCALE_STEP = 1.f / 32.f;
+
+void DynamicResolution::reset(const Params& p) {
+  m_params = p;
+  m_params.minScale = std::max(0.1f, std::min(p.minScale, p.maxScale));
+  m_scale = m_params.maxScale;
+  m_windowMs = 0.0;
+  m_samples.clear();
+  m_samples.reserve(256);
+}
+
+bool DynamicResolution::addFrame(double workMs, double intervalMs) {
+  m_samples.push_back(workMs);
+  m_windowMs += intervalMs;
+  if (m_windowMs < 1000.0) return false;
+
+  const float before = m_scale;
+  adjust();
+  m_windowMs = 0.0;
+  m_samples.clear();
+  return m_scale != before;
+}
+
+void DynamicResolution::adjust() {
+  if (m_samples.empty() || m_params.targetFps <= 0.f) return;
+
+  auto p90 = m_samples.begin() + (m_samples.size() * 9) / 10;
+  std::nth_element(m_samples.begin(), p90, m_samples.end());
+  const double slow = *p90;
+  const double budget = 1000.0 / m_params.targetFps;
+
+  float next = m_scale;
+  if (slow > budget * 0.9) {
+    // Aim for 80% of the budget; cost is roughly proportional to pixels
+    next = m_scale * (float)std::sqrt(budget * 0.8 / slow);
+    next = std::min(next, m_scale - SCALE_STEP);
+  } else if (slow < budget * 0.6) {
+    next = m_scale + SCALE_STEP;
+  }
+
+  next = std::round(next / SCALE_STEP) * SCALE_STEP;
+  m_scale = std::max(m_params.minScale, std::min(m_params.maxScale, next));
+}
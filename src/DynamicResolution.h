@@ -0,0 +1,36 @@
+// src/DynamicResolution.h
+#pragma once
+
+#include <vector>
+
+// Picks the internal render scale from measured frame times.
+//
+// Game reports the time of every continuously animated frame (recording and
+// flushing, without the vsync wait; the whole frame interval when there is
+// no vsync) and the wall time between frames.
+// Once a second the controller looks at the slow end of that window (90th
+// percentile): over budget it shrinks the scale in proportion (pixel cost
+// grows with scale^2); with plenty of headroom it grows back 1/32 at a time.
+class DynamicResolution {
+public:
+  struct Params {
+    float targetFps = 60.f;
+    float minScale  = 0.5f;
+    float maxScale  = 1.f;
+  };
+
+  void reset(const Params& p);
+
+  // Returns true when this frame closed a window and changed the scale
+  bool addFrame(double workMs, double intervalMs);
+
+  float scale() const { return m_scale; }
+
+private:
+  void adjust();
+
+  Params m_params{};
+  float  m_scale = 1.f;
+  double m_windowMs = 0.0;
+  std::vector<double> m_samples;
+};
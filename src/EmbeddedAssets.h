@@ -0,0 +1,20 @@
+// src/EmbeddedAssets.h
+#pragma once
+
+#include <cstddef>
+
+// Files compiled into the executable. The table is defined by the generated
+// EmbeddedAssets.cpp (tools/embed_assets.cpp), sorted by name; go through
+// openAsset() (Assets.h) rather than using it directly.
+namespace embedded {
+
+struct File {
+  const char*          name; // e.g. "fonts/DejaVuSans.ttf"
+  const unsigned char* data;
+  size_t               size;
+};
+
+extern const File FILES[];
+extern const int  FILE_COUNT;
+
+} // namespace embedded
@@ -0,0 +1,87 @@
+// src/FontCache.cpp
+#include "FontCache.h"
+
+#include <cmath>
+#include <cstdio>
+
+// SDL_ttf's default resolution: at 72 DPI a point is a pixel
+static constexpr unsigned BASE_DPI = 72;
+
+FontCache::~FontCache() {
+  for (Entry& e : m_fonts) {
+    if (e.refs > 0) std::printf("FontCache: %d pt font still in use at shutdown\n", e.ptSize);
+    TTF_CloseFont(e.font);
+  }
+  if (m_ttfInit) TTF_Quit();
+}
+
+bool FontCache::open(const char* name) {
+  if (!m_fonts.empty()) {
+    std::printf("FontCache: open() with fonts still acquired\n");
+    return false;
+  }
+
+  const Uint64 start = SDL_GetPerformanceCounter();
+  if (!m_ttfInit) {
+    if (TTF_Init() != 0) {
+      std::printf("FontCache: TTF_Init failed: %s\n", TTF_GetError());
+      return false;
+    }
+    m_ttfInit = true;
+  }
+  const Uint64 inited = SDL_GetPerformanceCounter();
+
+  m_file = openAsset(name);
+
+  const double toMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+  std::printf("FontCache: TTF_Init %.1f ms, %s %.1f ms\n", (double)(inited - start) * toMs,
+              name ? name : "(null)", (double)(SDL_GetPerformanceCounter() - inited) * toMs);
+  return (bool)m_file;
+}
+
+TTF_Font* FontCache::acquire(int ptSize, int style, float dpiScale) {
+  if (!m_file || ptSize <= 0) return nullptr;
+
+  const unsigned dpi = (unsigned)std::lround(BASE_DPI * (dpiScale > 0.f ? dpiScale : 1.f));
+  for (Entry& e : m_fonts) {
+    if (e.ptSize == ptSize && e.style == style && e.dpi == dpi) {
+      e.refs++;
+      return e.font;
+    }
+  }
+
+  // The RWops only wraps our bytes; TTF closes it with the font
+  SDL_RWops* rw = m_file.rw();
+  if (!rw) return nullptr;
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+  TTF_Font* font = TTF_OpenFontDPIRW(rw, 1, ptSize, dpi, dpi);
+#else
+  TTF_Font* font = TTF_OpenFontRW(rw, 1, (int)std::lround(ptSize * (float)dpi / BASE_DPI));
+#endif
+  if (!font) {
+    std::printf("FontCache: %d pt open failed: %s\n", ptSize, TTF_GetError());
+    return nullptr;
+  }
+  if (style != TTF_STYLE_NORMAL) TTF_SetFontStyle(font, style);
+
+  Entry e;
+  e.ptSize = ptSize;
+  e.style = style;
+  e.dpi = dpi;
+  e.font = font;
+  e.refs = 1;
+  m_fonts.push_back(e);
+  return font;
+}
+
+void FontCache::release(TTF_Font* font) {
+  if (!font) return;
+  for (size_t i = 0; i < m_fonts.size(); i++) {
+    if (m_fonts[i].font != font) continue;
+    if (--m_fonts[i].refs == 0) {
+      TTF_CloseFont(font);
+      m_fonts.erase(m_fonts.begin() + (long)i);
+    }
+    return;
+  }
+}
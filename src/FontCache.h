@@ -0,0 +1,57 @@
+// src/FontCache.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <vector>
+
+#include "Assets.h"
+
+// TTF_Font instances over one in-memory font file.
+//
+// Its one user today is Game's loader: it acquires a single face
+// (SDF_SOURCE_PT) once to build SdfFont's distance field and releases it
+// right after. Every string on screen, button labels baked into UiScreen
+// textures included, is drawn from that field, so no other size is ever
+// opened.
+//
+// open() looks the file up once (normally embedded in the executable, see
+// Assets.h) and faces are opened with TTF_OpenFontRW over those bytes, so
+// the disk is never touched. They are keyed by (point size, style, DPI)
+// and reference counted: each acquire() needs a matching release(), and
+// the cache must outlive every acquired font.
+//
+// SDL_ttf itself is initialized by the first open() (on the loader thread)
+// and shut down by the destructor, so startup doesn't pay for FreeType
+// before the field is built.
+class FontCache {
+public:
+  FontCache() = default;
+  ~FontCache();
+
+  FontCache(const FontCache&) = delete;
+  FontCache& operator=(const FontCache&) = delete;
+
+  bool open(const char* name); // asset name, e.g. "fonts/DejaVuSans.ttf"; inits SDL_ttf
+  bool isOpen() const { return (bool)m_file; }
+
+  // `dpiScale` is output pixels per window point (2 on a Retina display);
+  // nullptr if the font can't be opened.
+  TTF_Font* acquire(int ptSize, int style = TTF_STYLE_NORMAL, float dpiScale = 1.f);
+  void release(TTF_Font* font);
+
+  int openFonts() const { return (int)m_fonts.size(); }
+
+private:
+  struct Entry {
+    int       ptSize = 0;
+    int       style = TTF_STYLE_NORMAL;
+    unsigned  dpi = 72;
+    TTF_Font* font = nullptr;
+    int       refs = 0;
+  };
+
+  AssetView m_file; // shared by every font
+  bool m_ttfInit = false; // this cache called TTF_Init
+  std::vector<Entry> m_fonts; // a handful; linear search is fine
+};
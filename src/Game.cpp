@@ -1,7 +1,9 @@
 // src/Game.cpp
 #include "Game.h"
 
+#include <algorithm>
 #include <cstdio>
+#include <string>
 #include <utility>
 
 #include "Scene.h"
@@ -10,12 +12,112 @@
 #include "RaceScene.h"
 #include "OptionsScene.h"
 
-Game::Game(SDL_Window* window, SDL_Renderer* renderer, TTF_Font* font)
-  : m_window(window), m_renderer(renderer), m_font(font) {
+// The size the distance-field font is built from (bigger source glyphs
+// upscale better)
+static constexpr int SDF_SOURCE_PT = 48;
+
+Game::Game(SDL_Window* window, SDL_Renderer* renderer, FontCache& fonts,
+           const char* fontName, Uint64 launchCounter)
+  : m_window(window), m_renderer(renderer), m_fonts(&fonts),
+    m_launchCounter(launchCounter ? launchCounter : SDL_GetPerformanceCounter()) {
+  const char* stats = SDL_getenv("GAME_RENDER_STATS");
+  m_printRenderStats = stats && stats[0] && stats[0] != '0';
+
+  initSoftRaster();
+  m_textures.setRenderer(m_renderer, m_soft.get());
+
+  // GAME_DYNAMIC_RES=0 pins the internal resolution to the window size;
+  // GAME_TARGET_FPS sets the frame rate the scale controller aims for.
+  const char* dyn = SDL_getenv("GAME_DYNAMIC_RES");
+  m_dynamicRes = !(dyn && dyn[0] == '0');
+  DynamicResolution::Params res;
+  if (const char* fps = SDL_getenv("GAME_TARGET_FPS")) {
+    if (SDL_atoi(fps) > 0) res.targetFps = (float)SDL_atoi(fps);
+  }
+  m_resScale.reset(res);
+
+  startLoading(fontName);
   setScene(SceneId::Menu);
 }
 
-Game::~Game() = default;
+void Game::startLoading(const char* fontName) {
+  // Everything SDL_ttf does (TTF_Init included, see FontCache::open)
+  // happens in this one job, so the library is never used from two
+  // threads; the main thread stays off it until ready.
+  const std::string name = fontName ? fontName : "";
+  m_loader.start(AssetLoader::Asset::Fonts,
+    [this, name] {
+      if (!m_fonts->isOpen() && (name.empty() || !m_fonts->open(name.c_str()))) return false;
+
+      bool built = false;
+      if (TTF_Font* source = m_fonts->acquire(SDF_SOURCE_PT)) {
+        built = m_sdf.build(source);
+        m_fonts->release(source); // the field keeps everything it needs
+      }
+      return built;
+    },
+    [this](bool ok) {
+      if (ok) m_sdf.attach(m_textures);
+      else    std::printf("Game: fonts failed to load\n");
+    });
+
+  m_loader.start(AssetLoader::Asset::Sprites,
+    [this] { return m_atlas.read(); },
+    [this](bool ok) { if (ok) m_atlas.publish(m_textures); });
+}
+
+void Game::pollAssets() {
+  // New text or sprites can appear anywhere on screen
+  if (m_loader.poll()) m_fullRedraw = true;
+}
+
+void Game::finishLoading() {
+  m_loader.wait();
+  m_fullRedraw = true;
+}
+
+void Game::reportStartup(bool presented) {
+  if (!presented || m_interactiveReported) return;
+
+  const double toMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+  const double ms = (double)(SDL_GetPerformanceCounter() - m_launchCounter) * toMs;
+  if (!m_firstFrameReported) {
+    m_firstFrameReported = true;
+    std::printf("startup: first frame after %.1f ms\n", ms);
+  }
+  if (!m_loader.busy()) {
+    m_interactiveReported = true;
+    std::printf("startup: interactive after %.1f ms\n", ms);
+  }
+}
+
+void Game::initSoftRaster() {
+  // GAME_SOFT_RASTER=1 forces the CPU rasterizer, =0 disables it; by default
+  // it replaces SDL's own (single-threaded) software renderer. Offscreen
+  // (golden) runs always use it, so their frames don't depend on the
+  // environment.
+  const char* env = SDL_getenv("GAME_SOFT_RASTER");
+  bool use = false;
+  if (!m_window) {
+    use = true;
+  } else if (env && env[0]) {
+    use = (env[0] != '0');
+  } else if (m_renderer) {
+    SDL_RendererInfo info{};
+    use = SDL_GetRendererInfo(m_renderer, &info) == 0 && (info.flags & SDL_RENDERER_SOFTWARE);
+  }
+
+  if (use) {
+    m_soft = std::make_unique<SoftRaster>();
+    std::printf("Rendering with the tiled CPU rasterizer\n");
+  }
+}
+
+Game::~Game() {
+  m_loader.wait(); // jobs write into members
+  m_scene.reset(); // scenes release their texture handles
+  if (m_frameTex) SDL_DestroyTexture(m_frameTex);
+}
 
 void Game::requestQuit() { m_running = false; }
 
@@ -29,6 +131,14 @@ void Game::getRenderSize(int& w, int& h) const {
   if (m_renderer) SDL_GetRendererOutputSize(m_renderer, &w, &h);
 }
 
+float Game::dpiScale() const {
+  if (!m_window) return 1.f;
+  int ww = 0, wh = 0, rw = 0, rh = 0;
+  SDL_GetWindowSize(m_window, &ww, &wh);
+  getRenderSize(rw, rh);
+  return (ww > 0 && rw > 0) ? (float)rw / (float)ww : 1.f;
+}
+
 std::unique_ptr<Scene> Game::makeScene(SceneId id) {
   switch (id) {
     case SceneId::Menu:    return std::make_unique<MenuScene>(this);
@@ -41,6 +151,37 @@ std::unique_ptr<Scene> Game::makeScene(SceneId id) {
 void Game::setScene(SceneId id) {
   m_currentId = id;
   m_scene = makeScene(id);
+  m_fullRedraw = true;
+}
+
+void Game::setDeterministic(unsigned seed) {
+  m_deterministic = true;
+  m_dynamicRes = false; // frames must not depend on how fast this box is
+  m_seed = seed;
+  m_clockMs = 0.0;
+}
+
+Uint32 Game::ticks() const {
+  return m_deterministic ? (Uint32)m_clockMs : SDL_GetTicks();
+}
+
+unsigned Game::randomSeed() const {
+  return m_deterministic ? m_seed : (unsigned)SDL_GetTicks();
+}
+
+void Game::showScene(SceneId id) {
+  m_hasPendingSceneChange = false;
+  setScene(id);
+}
+
+void Game::step(float dt) {
+  m_clockMs += dt * 1000.0;
+  update(dt);
+}
+
+void Game::renderFrame() {
+  m_fullRedraw = true;
+  render();
 }
 
 // ---------------- NEW: Display controls ----------------
@@ -90,10 +231,18 @@ void Game::applyDisplayChanges() {
     m_window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
   );
 
+  m_rendererGeneration++;
+  m_frameTex = nullptr; // freed with the old renderer
+  if (m_soft) m_soft->rendererReset();
+  m_textures.setRenderer(m_renderer, m_soft.get()); // re-uploads lazily
+  m_frameTexFailed = false;
+  m_fullRedraw = true;
+
   if (!m_renderer) {
     std::printf("SDL_CreateRenderer failed after display change: %s\n", SDL_GetError());
     // If this fails, game can’t render—request quit
     requestQuit();
+    return;
   }
 }
 
@@ -105,6 +254,30 @@ void Game::handleEvent(const SDL_Event& e) {
     return;
   }
 
+  if (e.type == SDL_RENDER_TARGETS_RESET || e.type == SDL_RENDER_DEVICE_RESET) {
+    m_targetsGeneration++;
+    m_fullRedraw = true;
+    if (e.type == SDL_RENDER_DEVICE_RESET) {
+      m_textures.invalidate();
+      if (m_frameTex) SDL_DestroyTexture(m_frameTex);
+      m_frameTex = nullptr;
+    }
+  }
+
+  // The window contents may be stale or resized; skipped frames must catch up
+  if (e.type == SDL_WINDOWEVENT) {
+    switch (e.window.event) {
+      case SDL_WINDOWEVENT_SHOWN:
+      case SDL_WINDOWEVENT_EXPOSED:
+      case SDL_WINDOWEVENT_SIZE_CHANGED:
+      case SDL_WINDOWEVENT_RESTORED:
+        m_fullRedraw = true;
+        break;
+      default:
+        break;
+    }
+  }
+
   // Global Escape behavior (matches your original logic)
   if (e.type == SDL_KEYDOWN && e.key.repeat == 0 && e.key.keysym.sym == SDLK_ESCAPE) {
     if (m_currentId == SceneId::Menu) requestQuit();
@@ -124,8 +297,179 @@ void Game::update(float dt) {
   }
 }
 
-void Game::render() {
-  if (m_scene) m_scene->render(m_renderer);
+bool Game::ensureFrameTexture() {
+  int w = 0, h = 0;
+  getRenderSize(w, h);
+  if (w <= 0 || h <= 0 || m_frameTexFailed) return false;
+
+  if (m_frameTex && (w != m_frameW || h != m_frameH)) {
+    SDL_DestroyTexture(m_frameTex);
+    m_frameTex = nullptr;
+  }
+  if (!m_frameTex) {
+    m_frameTex = SDL_CreateTexture(m_renderer, SDL_PIXELFORMAT_ARGB8888,
+                                   SDL_TEXTUREACCESS_TARGET, w, h);
+    if (!m_frameTex) {
+      std::printf("Frame texture failed (%s); redrawing every frame\n", SDL_GetError());
+      m_frameTexFailed = true;
+      return false;
+    }
+    SDL_SetTextureBlendMode(m_frameTex, SDL_BLENDMODE_NONE);
+    SDL_SetTextureScaleMode(m_frameTex, SDL_ScaleModeLinear); // dynamic resolution upscale
+    m_frameW = w;
+    m_frameH = h;
+    m_fullRedraw = true;
+  }
+  return true;
+}
+
+void Game::renderScaled(float scale) {
+  int w = 0, h = 0;
+  getRenderSize(w, h);
+  const int sw = std::max(1, (int)(w * scale + 0.5f));
+  const int sh = std::max(1, (int)(h * scale + 0.5f));
+  const uint8_t lastWorldLayer = RenderQueue::LayerHud - 1;
+
+  // World layers at the reduced size, stretched to the window
+  if (m_soft) {
+    m_soft->begin(sw, sh, nullptr, scale);
+    m_queue.flush(*m_soft, 0, lastWorldLayer);
+    m_soft->present(m_renderer);
+  } else if (ensureFrameTexture()) {
+    // Scenes record in window coordinates; the render scale maps them into
+    // the top-left sw x sh of the (window-sized) frame texture
+    SDL_SetRenderTarget(m_renderer, m_frameTex);
+    SDL_RenderSetScale(m_renderer, scale, scale);
+    m_queue.flush(m_renderer, nullptr, 0, lastWorldLayer);
+    SDL_RenderSetScale(m_renderer, 1.f, 1.f);
+    SDL_SetRenderTarget(m_renderer, nullptr);
+
+    const SDL_Rect src { 0, 0, sw, sh };
+    SDL_RenderCopy(m_renderer, m_frameTex, &src, nullptr);
+  } else {
+    m_queue.flush(m_renderer, nullptr, 0, lastWorldLayer);
+  }
+
+  // HUD and overlays (mostly text) stay sharp at native resolution
+  m_queue.flush(m_renderer, nullptr, RenderQueue::LayerHud, 255);
+}
+
+void Game::trackFrameTime(Uint64 workStart) {
+  const Uint64 now = SDL_GetPerformanceCounter();
+  const double toMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+  double workMs = (double)(now - workStart) * toMs;
+
+  // Clamp gaps (idle scenes, window drags) so one stall doesn't end a window
+  double intervalMs = m_lastFrameCounter ? (double)(now - m_lastFrameCounter) * toMs : 0.0;
+  intervalMs = std::min(intervalMs, 100.0);
+  m_lastFrameCounter = now;
+
+  // Without vsync nothing waits between continuous frames, so the interval
+  // is the whole frame: it also covers the present and any GPU stall that
+  // the CPU-side work time can't see.
+  SDL_RendererInfo info{};
+  const bool vsync = SDL_GetRendererInfo(m_renderer, &info) == 0 &&
+                     (info.flags & SDL_RENDERER_PRESENTVSYNC);
+  if (!vsync) workMs = std::max(workMs, intervalMs);
+
+  if (m_resScale.addFrame(workMs, intervalMs) && m_printRenderStats) {
+    std::printf("render: dynamic resolution scale %.0f%%\n", m_resScale.scale() * 100.f);
+  }
+}
+
+bool Game::render() {
+  m_dirty.clear();
+  const bool tracked = m_scene && m_scene->dirtyRegions(m_dirty) &&
+                       (m_soft || ensureFrameTexture());
+  if (tracked && !m_fullRedraw && m_dirty.empty()) return false;
+
+  // One clip rect per flush, so redraw the bounding box of the changes
+  const SDL_Rect* clip = nullptr;
+  SDL_Rect box{};
+  if (tracked && !m_fullRedraw) {
+    box = m_dirty[0];
+    for (size_t i = 1; i < m_dirty.size(); i++) SDL_UnionRect(&box, &m_dirty[i], &box);
+    clip = &box;
+  }
+
+  const Uint64 workStart = SDL_GetPerformanceCounter();
+
+  m_queue.begin();
+  if (m_scene) m_scene->render(m_queue);
+
+  // Dirty-tracked scenes are cheap already; scale continuous ones only
+  const float scale = (!tracked && m_dynamicRes) ? m_resScale.scale() : 1.f;
+
+  if (scale < 1.f) {
+    renderScaled(scale);
+  } else if (m_soft) {
+    // The rasterizer's surface persists, so it doubles as the frame texture
+    int w = 0, h = 0;
+    getRenderSize(w, h);
+    m_soft->begin(w, h, clip);
+    m_queue.flush(*m_soft);
+    m_soft->present(m_renderer);
+  } else if (tracked) {
+    SDL_SetRenderTarget(m_renderer, m_frameTex);
+    m_queue.flush(m_renderer, clip);
+    SDL_SetRenderTarget(m_renderer, nullptr);
+
+    // The back buffer is undefined after a present, so copy the whole frame
+    SDL_RenderCopy(m_renderer, m_frameTex, nullptr, nullptr);
+  } else {
+    m_queue.flush(m_renderer);
+  }
+  m_fullRedraw = false;
+  m_sdf.trim(); // after the flush: this frame's text textures are done
+
+  if (!tracked && m_dynamicRes) {
+#if SDL_VERSION_ATLEAST(2, 0, 10)
+    // SDL batches draw calls until the present; run them inside the timing
+    SDL_RenderFlush(m_renderer);
+#endif
+    trackFrameTime(workStart);
+  }
+
+  if (m_printRenderStats) {
+    // Once a second is plenty to compare before/after
+    Uint64 now = SDL_GetPerformanceCounter();
+    if (now - m_statsTimer >= SDL_GetPerformanceFrequency()) {
+      m_statsTimer = now;
+      const RenderQueue::Stats& s = m_queue.stats();
+      std::printf("render: %d commands, %d state changes, %d flushes\n",
+        s.commands, s.stateChanges, s.flushes);
+    }
+  }
+
+  SDL_RenderPresent(m_renderer);
+  return true;
+}
+
+// Frame cap while the window is unfocused (~30 Hz keeps race dt under its clamp)
+static constexpr Uint32 UNFOCUSED_FRAME_MS = 33;
+
+bool Game::windowVisible() const {
+  const Uint32 flags = m_window ? SDL_GetWindowFlags(m_window) : 0;
+  return !(flags & (SDL_WINDOW_MINIMIZED | SDL_WINDOW_HIDDEN));
+}
+
+Uint32 Game::idleWait(bool presented) const {
+  if (!windowVisible()) return Scene::NO_DEADLINE;
+  const Uint32 flags = m_window ? SDL_GetWindowFlags(m_window) : 0;
+
+  Uint32 wait = m_scene ? m_scene->idleTimeout() : 0;
+  if (!presented) wait = std::max(wait, Scene::IDLE_FRAME_MS); // no vsync wait happened
+  if (!(flags & SDL_WINDOW_INPUT_FOCUS)) wait = std::max(wait, UNFOCUSED_FRAME_MS);
+  return wait;
+}
+
+void Game::waitForEvent(Uint32 ms) {
+  // Blocks the thread (no CPU) until input or the deadline; the event that
+  // woke us is handled here, the rest by the next SDL_PollEvent pass.
+  SDL_Event e{};
+  const int got = (ms == Scene::NO_DEADLINE) ? SDL_WaitEvent(&e)
+                                             : SDL_WaitEventTimeout(&e, (int)ms);
+  if (got) handleEvent(e);
 }
 
 void Game::run() {
@@ -154,9 +498,17 @@ void Game::run() {
     applyDisplayChanges();
     if (!m_running || !m_renderer) break;
 
-    update(dt);
-    render();
+    pollAssets();
+
+    // Nothing is visible while minimized: skip the frame and sleep
+    bool presented = false;
+    if (windowVisible()) {
+      update(dt);
+      presented = render();
+    }
+    reportStartup(presented);
 
-    SDL_RenderPresent(m_renderer);
+    const Uint32 wait = idleWait(presented);
+    if (wait > 0) waitForEvent(wait);
   }
 }
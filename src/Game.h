@@ -4,6 +4,16 @@
 #include <SDL2/SDL.h>
 #include <SDL2/SDL_ttf.h>
 #include <memory>
+#include <vector>
+
+#include "AssetLoader.h"
+#include "DynamicResolution.h"
+#include "FontCache.h"
+#include "RenderQueue.h"
+#include "SdfFont.h"
+#include "SoftRaster.h"
+#include "SpriteAtlas.h"
+#include "TextureRegistry.h"
 
 // Forward declarations
 class Scene;
@@ -12,7 +22,13 @@ class Game {
 public:
   enum class SceneId { Menu, Play, Options };
 
-  Game(SDL_Window* window, SDL_Renderer* renderer, TTF_Font* font);
+  // Fonts (asset `fontName` unless `fonts` is already open) and sprites
+  // load in the background; see assets(). Without a window (offscreen
+  // runs) frames always go through the CPU rasterizer. `launchCounter` is the
+  // SDL_GetPerformanceCounter() value startup times are reported from
+  // (0 = now).
+  Game(SDL_Window* window, SDL_Renderer* renderer, FontCache& fonts,
+       const char* fontName, Uint64 launchCounter = 0);
   ~Game();
 
   void run();
@@ -21,9 +37,50 @@ public:
   void requestScene(SceneId next);
 
   SDL_Renderer* renderer() const { return m_renderer; }
-  TTF_Font* font() const { return m_font; }
+
+  // Readiness of background-loaded assets. Until Fonts is ready, sdfFont()
+  // draws nothing; until Sprites is, atlas() quads draw nothing.
+  const AssetLoader& assets() const { return m_loader; }
+  void finishLoading(); // block until every asset is in (offscreen runs)
   void getRenderSize(int& w, int& h) const;
 
+  float dpiScale() const;
+
+  // Static textures by handle; handles stay valid across renderer rebuilds
+  TextureRegistry& textures() { return m_textures; }
+
+  // Scalable text (distance field built from the 48 pt face at startup)
+  SdfFont& sdfFont() { return m_sdf; }
+
+  // Packed sprites (see tools/atlas_packer.cpp); survives renderer rebuilds
+  const SpriteAtlas& atlas() const { return m_atlas; }
+
+  // CPU rasterizer standing in for SDL's software renderer, or nullptr.
+  // Textures drawn through it need their pixels registered with it.
+  SoftRaster* softRaster() const { return m_soft.get(); }
+
+  // Bumped whenever the renderer is recreated: every texture created from
+  // the old one is gone (SDL freed it with the renderer).
+  unsigned rendererGeneration() const { return m_rendererGeneration; }
+
+  // Bumped when render-target contents were lost (driver/device reset);
+  // the textures still exist and must be destroyed or redrawn.
+  unsigned targetsGeneration() const { return m_targetsGeneration; }
+
+  // Draw-call statistics of the last flushed frame
+  const RenderQueue::Stats& renderStats() const { return m_queue.stats(); }
+
+  // Deterministic driving for offscreen runs (see GoldenFrames.h): a fixed
+  // clock and seed replace wall time, and the caller steps frames itself
+  // instead of calling run(). Each call restarts the clock at 0.
+  void setDeterministic(unsigned seed);
+  bool deterministic() const { return m_deterministic; }
+  Uint32 ticks() const;        // ms clock scenes animate with
+  unsigned randomSeed() const; // seed for a new scene's RNGs
+  void showScene(SceneId id);  // switch immediately
+  void step(float dt);         // advance the clock, then update
+  void renderFrame();          // full redraw + present, ignoring dirty state
+
   // NEW: window access for display settings
   SDL_Window* window() const { return m_window; }
 
@@ -36,7 +93,17 @@ public:
 private:
   void handleEvent(const SDL_Event& e);
   void update(float dt);
-  void render();
+  bool render(); // false when the frame was skipped (nothing dirty)
+  void renderScaled(float scale);
+  void trackFrameTime(Uint64 workStart);
+  void initSoftRaster();
+  void startLoading(const char* fontName);
+  void pollAssets();
+  void reportStartup(bool presented);
+  bool ensureFrameTexture();
+  bool windowVisible() const;
+  Uint32 idleWait(bool presented) const;
+  void waitForEvent(Uint32 ms);
 
   void setScene(SceneId id);
   std::unique_ptr<Scene> makeScene(SceneId id);
@@ -44,7 +111,7 @@ private:
 private:
   SDL_Window*   m_window   = nullptr; // not owned
   SDL_Renderer* m_renderer = nullptr; // not owned (but we may recreate it)
-  TTF_Font*     m_font     = nullptr; // not owned
+  FontCache*    m_fonts    = nullptr; // not owned
 
   bool m_running = true;
 
@@ -54,7 +121,45 @@ private:
 
   std::unique_ptr<Scene> m_scene;
 
+  // Destroyed in reverse: atlas/font handles, then textures, then the rasterizer
+  std::unique_ptr<SoftRaster> m_soft;
+  TextureRegistry m_textures;
+  SpriteAtlas m_atlas;
+  SdfFont     m_sdf;
+
+  // Fills the members above; ~Game waits for it before anything goes
+  AssetLoader m_loader;
+  Uint64 m_launchCounter = 0;
+  bool   m_firstFrameReported = false;
+  bool   m_interactiveReported = false;
+
+  // Scenes record into this; flushed once per frame in render()
+  RenderQueue m_queue;
+  bool   m_printRenderStats = false; // GAME_RENDER_STATS=1
+  Uint64 m_statsTimer = 0;
+
+  // Dirty-region rendering: scenes that track changes draw into this
+  // persistent target, so untouched pixels survive across presents.
+  // Also the low-resolution target for dynamic resolution.
+  SDL_Texture* m_frameTex = nullptr;
+  int  m_frameW = 0, m_frameH = 0;
+  bool m_frameTexFailed = false; // no render targets: redraw everything
+  bool m_fullRedraw = true;
+  std::vector<SDL_Rect> m_dirty;
+
+  // Dynamic resolution: continuous scenes render their world layers at
+  // m_resScale.scale() (into m_frameTex or the CPU rasterizer) and upscale
+  bool   m_dynamicRes = true;
+  DynamicResolution m_resScale;
+  Uint64 m_lastFrameCounter = 0;
+
+  bool     m_deterministic = false;
+  unsigned m_seed = 0;
+  double   m_clockMs = 0.0;
+
   // NEW: display state
   bool m_isFullscreen = false;
   bool m_rendererDirty = false;
+  unsigned m_rendererGeneration = 0;
+  unsigned m_targetsGeneration = 0;
 };
@@ -0,0 +1,193 @@
+// src/GoldenFrames.cpp
+#include "GoldenFrames.h"
+
+#include <cstdio>
+#include <cstring>
+#include <filesystem>
+#include <map>
+#include <string>
+
+#include "Game.h"
+#include "OptionsScene.h"
+
+namespace {
+
+struct FrameCase {
+  const char*  name;
+  Game::SceneId scene;
+  int          ticks; // 60 Hz updates before the capture
+};
+
+const FrameCase CASES[] = {
+  { "menu",       Game::SceneId::Menu,    0 },
+  { "menu_pulse", Game::SceneId::Menu,    12 },  // highlight mid-pulse
+  { "options",    Game::SceneId::Options, 0 },
+  { "race_start", Game::SceneId::Play,    0 },
+  { "race_2s",    Game::SceneId::Play,    120 },
+  { "race_10s",   Game::SceneId::Play,    600 },
+};
+
+const unsigned SEED = 12345;
+
+inline uint64_t read64(const uint8_t* p) {
+  uint64_t v;
+  std::memcpy(&v, p, 8);
+  return v;
+}
+
+inline uint64_t mix(uint64_t acc, uint64_t v) {
+  acc ^= v * 0x9E3779B97F4A7C15ull;
+  acc = (acc << 31) | (acc >> 33);
+  return acc * 0xC2B2AE3D27D4EB4Full;
+}
+
+std::map<std::string, uint64_t> readGoldens(const char* path) {
+  std::map<std::string, uint64_t> out;
+  std::FILE* f = std::fopen(path, "r");
+  if (!f) return out;
+
+  char line[256];
+  while (std::fgets(line, sizeof(line), f)) {
+    char name[64], size[32];
+    unsigned long long hash = 0;
+    if (line[0] == '#') continue;
+    if (std::sscanf(line, "%63s %31s %llx", name, size, &hash) == 3) {
+      out[std::string(name) + " " + size] = (uint64_t)hash;
+    }
+  }
+  std::fclose(f);
+  return out;
+}
+
+bool writePpm(const std::string& path, const SDL_Surface* s) {
+  std::FILE* f = std::fopen(path.c_str(), "wb");
+  if (!f) return false;
+
+  std::fprintf(f, "P6\n%d %d\n255\n", s->w, s->h);
+  std::string row((size_t)s->w * 3, '\0');
+  for (int y = 0; y < s->h; y++) {
+    const uint32_t* px = (const uint32_t*)((const uint8_t*)s->pixels + (size_t)y * s->pitch);
+    for (int x = 0; x < s->w; x++) {
+      row[x * 3 + 0] = (char)((px[x] >> 16) & 255);
+      row[x * 3 + 1] = (char)((px[x] >> 8) & 255);
+      row[x * 3 + 2] = (char)(px[x] & 255);
+    }
+    std::fwrite(row.data(), 1, row.size(), f);
+  }
+  std::fclose(f);
+  return true;
+}
+
+} // namespace
+
+uint64_t hashFrame(const SDL_Surface* s) {
+  if (!s || !s->pixels) return 0;
+
+  // Four independent lanes keep the multiplies pipelined (~memory speed)
+  uint64_t lane[4] = { 1, 2, 3, 4 };
+  const size_t rowBytes = (size_t)s->w * 4;
+
+  for (int y = 0; y < s->h; y++) {
+    const uint8_t* p = (const uint8_t*)s->pixels + (size_t)y * s->pitch;
+    size_t i = 0;
+    for (; i + 32 <= rowBytes; i += 32) {
+      for (int k = 0; k < 4; k++) lane[k] = mix(lane[k], read64(p + i + k * 8));
+    }
+    for (; i + 8 <= rowBytes; i += 8) lane[0] = mix(lane[0], read64(p + i));
+    for (; i < rowBytes; i++) lane[1] = mix(lane[1], p[i]);
+  }
+
+  uint64_t h = ((uint64_t)s->w << 32) | (uint32_t)s->h;
+  for (uint64_t l : lane) h = mix(h, l);
+  h ^= h >> 29;
+  h *= 0xBF58476D1CE4E5B9ull;
+  return h ^ (h >> 32);
+}
+
+int runGoldenFrames(FontCache& fonts, const char* goldenPath, const char* dumpDir, bool update) {
+  const std::map<std::string, uint64_t> goldens = readGoldens(goldenPath);
+  std::map<std::string, uint64_t> results;
+  int failures = 0;
+
+  // Nothing to compare against is a setup problem, not N failing frames
+  if (!update && goldens.empty()) {
+    std::printf("golden: no values in %s (record them with --golden-update)\n", goldenPath);
+    return GOLDEN_NO_VALUES;
+  }
+
+  const Uint64 start = SDL_GetPerformanceCounter();
+
+  for (const auto& res : OptionsScene::RESOLUTIONS) {
+    const int w = res[0], h = res[1];
+
+    SDL_Surface* target = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    SDL_Renderer* renderer = target ? SDL_CreateSoftwareRenderer(target) : nullptr;
+    if (!renderer) {
+      std::printf("golden: cannot create a %dx%d software renderer: %s\n", w, h, SDL_GetError());
+      if (target) SDL_FreeSurface(target);
+      return 1;
+    }
+
+    {
+      Game game(nullptr, renderer, fonts, nullptr);
+      game.finishLoading(); // frames must not depend on loader timing
+
+      for (const FrameCase& c : CASES) {
+        game.setDeterministic(SEED);
+        game.showScene(c.scene);
+        for (int t = 0; t < c.ticks; t++) game.step(1.f / 60.f);
+        game.renderFrame();
+
+        char size[32];
+        std::snprintf(size, sizeof(size), "%dx%d", w, h);
+        const std::string key = std::string(c.name) + " " + size;
+        const uint64_t hash = hashFrame(target);
+        results[key] = hash;
+        if (update) continue;
+
+        auto it = goldens.find(key);
+        const bool known = (it != goldens.end());
+        if (known && it->second == hash) continue;
+
+        failures++;
+        std::string ppm;
+        if (dumpDir && dumpDir[0]) {
+          std::error_code ec;
+          std::filesystem::create_directories(dumpDir, ec);
+          ppm = std::string(dumpDir) + "/" + c.name + "_" + size + ".ppm";
+          if (!writePpm(ppm, target)) ppm = "(dump failed)";
+        }
+        std::printf("golden: %-10s %-9s %s %016llx %s\n", c.name, size,
+          known ? "MISMATCH" : "NEW     ", (unsigned long long)hash, ppm.c_str());
+      }
+    }
+
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(target);
+  }
+
+  const double secs = (double)(SDL_GetPerformanceCounter() - start) / (double)SDL_GetPerformanceFrequency();
+
+  if (update) {
+    std::error_code ec;
+    const std::filesystem::path dir = std::filesystem::path(goldenPath).parent_path();
+    if (!dir.empty()) std::filesystem::create_directories(dir, ec);
+
+    std::FILE* f = std::fopen(goldenPath, "w");
+    if (!f) {
+      std::printf("golden: cannot write %s\n", goldenPath);
+      return 1;
+    }
+    std::fprintf(f, "# name WxH hash (regenerate with: game --golden-update)\n");
+    for (const auto& r : results) {
+      std::fprintf(f, "%s %016llx\n", r.first.c_str(), (unsigned long long)r.second);
+    }
+    std::fclose(f);
+    std::printf("golden: recorded %d frames to %s in %.2fs\n", (int)results.size(), goldenPath, secs);
+    return 0;
+  }
+
+  std::printf("golden: %d/%d frames match (%.2fs)\n",
+    (int)results.size() - failures, (int)results.size(), secs);
+  return failures == 0 ? 0 : 1;
+}
@@ -0,0 +1,31 @@
+// src/GoldenFrames.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <cstdint>
+
+#include "FontCache.h"
+
+// runGoldenFrames() result when there is nothing to compare against
+constexpr int GOLDEN_NO_VALUES = 2;
+
+// Offscreen rendering regression check (`game --golden`).
+//
+// Renders Menu, Options and Race at a fixed seed and fixed tick counts, at
+// every OptionsScene resolution, into a software-renderer surface (no window
+// or GPU needed). Each frame is hashed and compared with `goldenPath`, a text
+// file of "name WxH hash" lines. Frames that differ or have no golden value
+// are written to `dumpDir` as PPM. With `update` the golden file is rewritten
+// from this run instead. Returns 0 when every frame matched, 1 on mismatches
+// or errors, and GOLDEN_NO_VALUES (without rendering anything) when
+// `goldenPath` is missing or holds no values.
+//
+// Frames always go through the CPU rasterizer (GAME_SOFT_RASTER is
+// ignored), so hashes only depend on the font file and the SDL_ttf /
+// FreeType build that rasterized it.
+int runGoldenFrames(FontCache& fonts, const char* goldenPath, const char* dumpDir, bool update);
+
+// Fast non-cryptographic hash of a surface's visible pixels (pitch padding
+// is skipped, so it only depends on the image).
+uint64_t hashFrame(const SDL_Surface* s);
@@ -0,0 +1,37 @@
+// src/HudLine.cpp
+#include "HudLine.h"
+
+#include <charconv>
+
+void HudLine::begin(RenderQueue& q, SdfFont& font, uint8_t layer,
+                    float x, float y, float px, SDL_Color c) {
+  m_queue = &q;
+  m_font = &font;
+  m_layer = layer;
+  m_x = x;
+  m_y = y;
+  m_px = px;
+  m_color = c;
+}
+
+HudLine& HudLine::label(const char* text) {
+  if (!m_font || !text) return *this;
+
+  TextStyle style;
+  style.px = m_px;
+  const TextLayout& l = m_font->layout(text, style);
+  m_font->draw(*m_queue, m_layer, l, m_x, m_y, m_color);
+  m_x += l.advance;
+  return *this;
+}
+
+HudLine& HudLine::number(long long value) {
+  if (!m_font) return *this;
+
+  char buf[24];
+  const std::to_chars_result r = std::to_chars(buf, buf + sizeof(buf), value);
+  if (r.ec == std::errc()) {
+    m_x += m_font->drawRun(*m_queue, m_layer, buf, r.ptr, m_x, m_y, m_px, m_color);
+  }
+  return *this;
+}
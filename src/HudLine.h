@@ -0,0 +1,37 @@
+// src/HudLine.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+
+#include "RenderQueue.h"
+#include "SdfFont.h"
+
+// One line of HUD text built from fixed labels and live integers, e.g.
+//
+//   hud.begin(q, font, layer, x, y, px, color);
+//   hud.label("Level ").number(level).label("   Distance: ").number(dist);
+//
+// Labels must be constant strings: their layouts stay in the SdfFont cache,
+// so a label costs one hash lookup. Numbers are formatted with
+// std::to_chars into a stack buffer and drawn as a glyph run. Once the
+// font's buffers and the queue have grown to size, a frame's HUD makes no
+// heap allocations and no SDL_ttf calls: just a few batched quads.
+class HudLine {
+public:
+  void begin(RenderQueue& q, SdfFont& font, uint8_t layer,
+             float x, float y, float px, SDL_Color c);
+
+  HudLine& label(const char* text);
+  HudLine& number(long long value);
+
+  // Pen position after the last segment
+  float x() const { return m_x; }
+
+private:
+  RenderQueue* m_queue = nullptr;
+  SdfFont*     m_font = nullptr;
+  uint8_t      m_layer = 0;
+  float        m_x = 0.f, m_y = 0.f, m_px = 0.f;
+  SDL_Color    m_color{};
+};
@@ -0,0 +1,41 @@
+// src/LaneReachability.cpp
+#include "LaneReachability.h"
+
+#include <algorithm>
+
+void LaneReachability::reset(int lanes) {
+  m_lanes = std::max(1, std::min(lanes, MAX_LANES));
+  m_all = (1u << m_lanes) - 1u;
+  m_frontier = m_all; // car can still get anywhere before the first row
+}
+
+uint32_t LaneReachability::reachable(int reach) const {
+  uint32_t m = m_frontier;
+
+  // Each step lets the car drift one lane either way; after m_lanes steps
+  // the mask cannot grow any further.
+  reach = std::min(std::max(0, reach), m_lanes);
+  for (int i = 0; i < reach && m != m_all; i++) {
+    m = (m | (m << 1) | (m >> 1)) & m_all;
+  }
+  return m;
+}
+
+uint32_t LaneReachability::safeToBlock(int reach) const {
+  uint32_t m = reachable(reach);
+
+  uint32_t safe = 0u;
+  for (int lane = 0; lane < m_lanes; lane++) {
+    uint32_t bit = 1u << lane;
+    if ((m & ~bit) != 0u) safe |= bit;
+  }
+  return safe;
+}
+
+void LaneReachability::commit(int lane, int reach) {
+  uint32_t m = reachable(reach);
+  if (lane >= 0 && lane < m_lanes) m &= ~(1u << lane);
+
+  // Never leave an empty frontier behind (caller ignored safeToBlock()).
+  m_frontier = (m != 0u) ? m : m_all;
+}
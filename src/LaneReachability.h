@@ -0,0 +1,35 @@
+// src/LaneReachability.h
+#pragma once
+
+#include <cstdint>
+
+// Incremental solvability check for single-lane obstacle spawns.
+//
+// Keeps a bitmask "frontier" of lanes the car can occupy at the row of the
+// most recent spawn. A new spawn further ahead first widens the frontier by
+// the number of lanes the car can cross in that gap, then removes the blocked
+// lane. A spawn that would empty the frontier is unwinnable and gets rejected.
+// Every operation is O(lanes).
+class LaneReachability {
+public:
+  static constexpr int MAX_LANES = 16;
+
+  void reset(int lanes);
+
+  int lanes() const { return m_lanes; }
+  uint32_t frontier() const { return m_frontier; }
+
+  // Lanes reachable at a row `reach` lane-changes after the current frontier.
+  uint32_t reachable(int reach) const;
+
+  // Lanes that may be blocked at that row while keeping a path open.
+  uint32_t safeToBlock(int reach) const;
+
+  // Advance the frontier to a new row with `lane` blocked.
+  void commit(int lane, int reach);
+
+private:
+  int      m_lanes = 1;
+  uint32_t m_all = 1u;
+  uint32_t m_frontier = 1u;
+};
@@ -4,8 +4,6 @@
 #include <SDL2/SDL.h>
 #include <algorithm>
 
-#include "Text.h" // drawTextCentered(...)
-
 struct MenuItem { const char* id; };
 
 static constexpr MenuItem MENU[] = {
@@ -13,13 +11,60 @@ static constexpr MenuItem MENU[] = {
   {"Options"},
   {"Quit"}
 };
-static constexpr int MENU_COUNT = (int)(sizeof(MENU) / sizeof(MENU[0]));
 
-MenuScene::MenuScene(Game* game) : m_game(game) {}
+// Highlight green at the top of the pulse; the selected button is baked
+// with it and dimmed from there by its texture colour mod
+static constexpr int PULSE_PEAK = 200;
+
+MenuScene::MenuScene(Game* game) : m_game(game), m_ui(game->sdfFont(), game->textures()) {
+  const UiScreen::Box box{ SDL_Color{ 30, 34, 48, 255 },   // fill
+                           SDL_Color{ 50, 60, 80, 255 },   // outline
+                           SDL_Color{ 12, 12, 16, 140 } }; // inner outline for depth
+  UiScreen::ListStyle style;
+  style.gap = 18.f;
+  style.highlight = SDL_Color{ 80, (Uint8)PULSE_PEAK, 255, 255 };
+  style.marker = SDL_Color{ 12, 12, 16, 220 }; // tiny indicator on the selected item
+
+  m_list = m_ui.list(-1, style);
+  for (const MenuItem& item : MENU) {
+    m_ui.button(m_list, item.id, 320.f, 70.f, 36.f, SDL_Color{ 230, 235, 245, 255 }, box);
+  }
+}
 
 float MenuScene::pulse() const {
   // 0..1 pulse
-  return 0.5f + 0.5f * SDL_sinf((float)SDL_GetTicks() * 0.008f);
+  return 0.5f + 0.5f * SDL_sinf((float)m_game->ticks() * 0.008f);
+}
+
+Uint8 MenuScene::selectedBright() const {
+  return (Uint8)(140 + 60 * pulse());
+}
+
+void MenuScene::syncUi() {
+  int w = 0, h = 0;
+  m_game->getRenderSize(w, h);
+  m_ui.resize(w, h, m_game->dpiScale());
+  const Uint8 mod = (Uint8)(selectedBright() * 255 / PULSE_PEAK);
+  m_ui.setHighlightMod(m_list, SDL_Color{ mod, mod, mod, 255 });
+}
+
+bool MenuScene::dirtyRegions(std::vector<SDL_Rect>& rects) {
+  if (!m_game) return false;
+
+  // Only the highlighted button animates; everything else is static
+  syncUi();
+  m_ui.damage(rects);
+  return true;
+}
+
+Uint32 MenuScene::idleTimeout() const {
+  // Sleep until the pulse moves the colour mod by one step:
+  // d(mod)/dt = 255 / PULSE_PEAK * 60 * 0.5 * 0.008 * cos(t * 0.008) levels per ms
+  const float rate = 0.306f * SDL_fabsf(SDL_cosf((float)m_game->ticks() * 0.008f));
+  const float maxWait = 50.f; // pulse peaks, where the colour barely moves
+  if (rate * maxWait <= 1.f) return (Uint32)maxWait;
+  // At least a frame: without vsync the steep part would redraw at ~240 Hz
+  return std::max(IDLE_FRAME_MS, (Uint32)(1.f / rate));
 }
 
 void MenuScene::handleEvent(const SDL_Event& e) {
@@ -29,20 +74,24 @@ void MenuScene::handleEvent(const SDL_Event& e) {
     switch (e.key.keysym.sym) {
       case SDLK_UP:
       case SDLK_w:
-        m_index = (m_index - 1 + MENU_COUNT) % MENU_COUNT;
+        m_ui.move(m_list, -1);
         break;
 
       case SDLK_DOWN:
       case SDLK_s:
-        m_index = (m_index + 1) % MENU_COUNT;
+        m_ui.move(m_list, +1);
         break;
 
       case SDLK_RETURN:
-      case SDLK_KP_ENTER:
-        if (m_index == 0)      m_game->requestScene(Game::SceneId::Play);
-        else if (m_index == 1) m_game->requestScene(Game::SceneId::Options);
-        else if (m_index == 2) m_game->requestQuit();
+      case SDLK_KP_ENTER: {
+        // Start and Options need the fonts and sprites still loading
+        const int index = m_ui.selected(m_list);
+        if (index != 2 && m_game->assets().busy()) break;
+        if (index == 0)      m_game->requestScene(Game::SceneId::Play);
+        else if (index == 1) m_game->requestScene(Game::SceneId::Options);
+        else if (index == 2) m_game->requestQuit();
         break;
+      }
 
       default:
         break;
@@ -51,56 +100,13 @@ void MenuScene::handleEvent(const SDL_Event& e) {
 }
 
 void MenuScene::update(float) {
-  // nothing yet (pulse is time-based via SDL_GetTicks)
+  // nothing yet (pulse is time-based via Game::ticks)
 }
 
-void MenuScene::render(SDL_Renderer* r) {
-  if (!m_game || !r) return;
-
-  int w = 0, h = 0;
-  m_game->getRenderSize(w, h);
-
-  SDL_SetRenderDrawColor(r, 12, 12, 16, 255);
-  SDL_RenderClear(r);
-
-  const float p = pulse();
-
-  const float bw = 320.f, bh = 70.f;
-  const float gap = 18.f;
-  const float totalH = MENU_COUNT * bh + (MENU_COUNT - 1) * gap;
-
-  float x = (w - bw) * 0.5f;
-  float y = (h - totalH) * 0.5f;
-
-  for (int i = 0; i < MENU_COUNT; i++) {
-    SDL_FRect box { x, y + i * (bh + gap), bw, bh };
-
-    // background fill
-    if (i == m_index) {
-      Uint8 bright = (Uint8)(140 + 60 * p);
-      SDL_SetRenderDrawColor(r, 80, bright, 255, 255);
-    } else {
-      SDL_SetRenderDrawColor(r, 30, 34, 48, 255);
-    }
-    SDL_RenderFillRectF(r, &box);
-
-    // outline
-    SDL_SetRenderDrawColor(r, 50, 60, 80, 255);
-    SDL_RenderDrawRectF(r, &box);
-
-    // inner outline for depth
-    SDL_FRect inner { box.x + 4, box.y + 4, box.w - 8, box.h - 8 };
-    SDL_SetRenderDrawColor(r, 12, 12, 16, 140);
-    SDL_RenderDrawRectF(r, &inner);
-
-    // text label
-    drawTextCentered(r, m_game->font(), MENU[i].id, box);
+void MenuScene::render(RenderQueue& q) {
+  if (!m_game) return;
 
-    // tiny indicator on selected item
-    if (i == m_index) {
-      SDL_FRect notch { box.x + 10, box.y + box.h * 0.5f - 6, 12, 12 };
-      SDL_SetRenderDrawColor(r, 12, 12, 16, 220);
-      SDL_RenderFillRectF(r, &notch);
-    }
-  }
+  q.clear(SDL_Color{ 12, 12, 16, 255 });
+  syncUi();
+  m_ui.render(q, RenderQueue::LayerWorld);
 }
@@ -3,6 +3,7 @@
 
 #include "Scene.h"
 #include "Game.h"
+#include "UiScreen.h"
 
 // Minimal menu scene: Start / Options / Quit
 class MenuScene : public Scene {
@@ -11,11 +12,17 @@ public:
 
   void handleEvent(const SDL_Event& e) override;
   void update(float dt) override;
-  void render(SDL_Renderer* r) override;
+  void render(RenderQueue& q) override;
+  bool dirtyRegions(std::vector<SDL_Rect>& rects) override;
+  Uint32 idleTimeout() const override;
 
 private:
   Game* m_game = nullptr; // not owned
-  int   m_index = 0;
+
+  UiScreen     m_ui;
+  UiScreen::Id m_list = -1; // one button per menu entry
 
   float pulse() const; // simple highlight animation
+  Uint8 selectedBright() const;
+  void  syncUi(); // screen size and highlight colour
 };
@@ -0,0 +1,76 @@
+// src/ObstacleStream.cpp
+#include "ObstacleStream.h"
+
+#include <algorithm>
+#include <chrono>
+
+ObstacleStream::ObstacleStream()
+  : m_thread(&ObstacleStream::producerLoop, this) {}
+
+ObstacleStream::~ObstacleStream() {
+  m_running.store(false, std::memory_order_relaxed);
+  if (m_thread.joinable()) m_thread.join();
+}
+
+void ObstacleStream::restart(int lanes, unsigned seed) {
+  m_lanes.store(lanes, std::memory_order_relaxed);
+  m_seed.store(seed, std::memory_order_relaxed);
+  m_epoch.fetch_add(1, std::memory_order_release);
+
+  // Flush what is already queued; anything still in flight from the old
+  // epoch is skipped by next().
+  SpawnPlan stale{};
+  while (m_ring.pop(stale)) {}
+}
+
+bool ObstacleStream::next(int& lane, bool wait) {
+  const uint32_t epoch = m_epoch.load(std::memory_order_relaxed);
+
+  SpawnPlan plan{};
+  for (;;) {
+    while (m_ring.pop(plan)) {
+      if (plan.epoch != epoch) continue;
+      lane = plan.lane;
+      return true;
+    }
+    if (!wait) return false;
+    std::this_thread::yield();
+  }
+}
+
+int ObstacleStream::generateLane() {
+  std::uniform_int_distribution<int> pickLane(0, m_genLanes - 1);
+
+  // Tiny bias against repeating the same lane too much
+  int lane = pickLane(m_rng);
+  if (m_lastLane >= 0 && m_genLanes > 1) {
+    // 60% chance: choose a different lane than last time
+    if (std::uniform_int_distribution<int>(0, 9)(m_rng) < 6) {
+      int tries = 0;
+      while (lane == m_lastLane && tries++ < 6) lane = pickLane(m_rng);
+    }
+  }
+
+  m_lastLane = lane;
+  return lane;
+}
+
+void ObstacleStream::producerLoop() {
+  while (m_running.load(std::memory_order_relaxed)) {
+    const uint32_t epoch = m_epoch.load(std::memory_order_acquire);
+    if (epoch != m_genEpoch) {
+      m_genEpoch = epoch;
+      m_genLanes = std::max(1, m_lanes.load(std::memory_order_relaxed));
+      m_rng.seed(m_seed.load(std::memory_order_relaxed));
+      m_lastLane = -1;
+    }
+
+    if (m_ring.full()) {
+      // Plenty queued; the consumer drains at most a few entries per second
+      std::this_thread::sleep_for(std::chrono::milliseconds(10));
+      continue;
+    }
+
+    m_ring.push(SpawnPlan{ m_genEpoch, generateLane() });
+  }
+}
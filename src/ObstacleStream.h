@@ -0,0 +1,59 @@
+// src/ObstacleStream.h
+#pragma once
+
+#include "SpscRing.h"
+
+#include <atomic>
+#include <cstdint>
+#include <random>
+#include <thread>
+
+// Background generator for upcoming obstacle spawns.
+//
+// A producer thread keeps a ring of planned spawns filled well ahead of the
+// race (capacity() entries, i.e. several seconds at the fastest spawn rate),
+// so RaceScene::update only pops one entry per spawn. Velocity-dependent
+// checks (LaneReachability) still happen on pop since they need the car state
+// at spawn time; they are O(lanes) anyway.
+class ObstacleStream {
+public:
+  ObstacleStream();
+  ~ObstacleStream();
+
+  ObstacleStream(const ObstacleStream&) = delete;
+  ObstacleStream& operator=(const ObstacleStream&) = delete;
+
+  // Consumer side: drop everything queued and start a new pattern stream
+  // (call on level start / retry).
+  void restart(int lanes, unsigned seed);
+
+  // Consumer side: next planned lane. Returns false if the producer has
+  // fallen behind; the caller should pick a lane itself. With `wait` it
+  // yields until the producer catches up instead (deterministic runs).
+  bool next(int& lane, bool wait = false);
+
+private:
+  struct SpawnPlan {
+    uint32_t epoch;
+    int      lane;
+  };
+
+  void producerLoop();
+  int  generateLane();
+
+  SpscRing<SpawnPlan, 64> m_ring;
+
+  // Written by consumer, read by producer (epoch published last)
+  std::atomic<int>      m_lanes{1};
+  std::atomic<unsigned> m_seed{0};
+  std::atomic<uint32_t> m_epoch{0};
+  std::atomic<bool>     m_running{true};
+
+  // Producer-only state
+  std::mt19937 m_rng;
+  uint32_t     m_genEpoch = 0;
+  int          m_genLanes = 1;
+  int          m_lastLane = -1;
+
+  std::thread m_thread; // declared last so everything above is ready
+};
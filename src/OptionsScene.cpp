@@ -4,30 +4,71 @@
 #include <SDL2/SDL.h>
 #include <cstdio>
 
-#include "Text.h"
+static constexpr SDL_Color TEXT_COLOR{ 230, 235, 245, 255 };
 
-OptionsScene::OptionsScene(Game* game) : m_game(game) {}
+OptionsScene::OptionsScene(Game* game) : m_game(game), m_ui(game->sdfFont(), game->textures()) {
+  // centered panel
+  UiScreen::Box panel;
+  panel.fill = SDL_Color{ 30, 34, 48, 255 };
+  panel.border = SDL_Color{ 80, 180, 255, 255 };
+  const UiScreen::Id root = m_ui.panel(-1, 520.f, 340.f, panel, 18.f, 14.f);
+
+  m_ui.label(root, "Options", 46.f, TEXT_COLOR, 62.f);
+
+  UiScreen::ListStyle style;
+  style.gap = 8.f;
+  style.highlight = SDL_Color{ 52, 92, 140, 255 };
+  m_list = m_ui.list(root, style);
+
+  UiScreen::Box row;
+  row.fill = SDL_Color{ 38, 44, 62, 255 };
+  m_fullscreen = m_ui.button(m_list, "", 0.f, 44.f, 33.f, TEXT_COLOR, row);
+  m_resolution = m_ui.button(m_list, "", 0.f, 44.f, 33.f, TEXT_COLOR, row);
+
+  m_ui.label(root, "F / R or Up, Down and Enter to change\nPress ESC to return to Menu",
+             24.f, SDL_Color{ 170, 178, 196, 255 }, 90.f);
+}
 
 void OptionsScene::cycleResolution() {
   if (!m_game) return;
 
   m_resIndex = (m_resIndex + 1) % RES_COUNT;
-  int w = m_resolutions[m_resIndex][0];
-  int h = m_resolutions[m_resIndex][1];
+  int w = RESOLUTIONS[m_resIndex][0];
+  int h = RESOLUTIONS[m_resIndex][1];
   m_game->setWindowedResolution(w, h);
 }
 
+void OptionsScene::activate(int index) {
+  if (index == 0) m_game->toggleFullscreen();
+  else            cycleResolution();
+}
+
 void OptionsScene::handleEvent(const SDL_Event& e) {
   if (!m_game) return;
 
   if (e.type == SDL_KEYDOWN && e.key.repeat == 0) {
     switch (e.key.keysym.sym) {
       case SDLK_f: // fullscreen toggle
-        m_game->toggleFullscreen();
+        activate(0);
         break;
 
       case SDLK_r: // cycle resolution (windowed only)
-        cycleResolution();
+        activate(1);
+        break;
+
+      case SDLK_UP:
+      case SDLK_w:
+        m_ui.move(m_list, -1);
+        break;
+
+      case SDLK_DOWN:
+      case SDLK_s:
+        m_ui.move(m_list, +1);
+        break;
+
+      case SDLK_RETURN:
+      case SDLK_KP_ENTER:
+        activate(m_ui.selected(m_list));
         break;
 
       default:
@@ -40,38 +81,32 @@ void OptionsScene::update(float) {
   // nothing yet
 }
 
-void OptionsScene::render(SDL_Renderer* r) {
-  if (!m_game || !r) return;
-
+void OptionsScene::syncUi() {
   int w = 0, h = 0;
   m_game->getRenderSize(w, h);
+  m_ui.resize(w, h, m_game->dpiScale());
 
-  SDL_SetRenderDrawColor(r, 16, 12, 20, 255);
-  SDL_RenderClear(r);
+  // setText() is a no-op (and keeps the layout) while the text is unchanged
+  m_ui.setText(m_fullscreen, m_game->isFullscreen() ? "Fullscreen: ON" : "Fullscreen: OFF");
 
-  // centered panel
-  SDL_FRect panel { w * 0.5f - 260.f, h * 0.5f - 170.f, 520.f, 340.f };
-  SDL_SetRenderDrawColor(r, 30, 34, 48, 255);
-  SDL_RenderFillRectF(r, &panel);
-  SDL_SetRenderDrawColor(r, 80, 180, 255, 255);
-  SDL_RenderDrawRectF(r, &panel);
-
-  // Title
-  SDL_FRect titleBox { panel.x, panel.y + 18.f, panel.w, 44.f };
-  drawTextCentered(r, m_game->font(), "Options", titleBox);
-
-  // Current mode line
-  const char* mode = m_game->isFullscreen() ? "Fullscreen: ON (F to toggle)" : "Fullscreen: OFF (F to toggle)";
-  SDL_FRect modeBox { panel.x, panel.y + 86.f, panel.w, 36.f };
-  drawTextCentered(r, m_game->font(), mode, modeBox);
-
-  // Resolution line (renderer output size reflects actual size)
-  char buf[128];
-  std::snprintf(buf, sizeof(buf), "Resolution: %dx%d (R to cycle)", w, h);
-  SDL_FRect resBox { panel.x, panel.y + 132.f, panel.w, 36.f };
-  drawTextCentered(r, m_game->font(), buf, resBox);
-
-  // Hint
-  SDL_FRect hintBox { panel.x, panel.y + 220.f, panel.w, 80.f };
-  drawTextCentered(r, m_game->font(), "Press ESC to return to Menu", hintBox);
+  // Renderer output size reflects the actual size
+  char buf[64];
+  std::snprintf(buf, sizeof(buf), "Resolution: %dx%d", w, h);
+  m_ui.setText(m_resolution, buf);
+}
+
+bool OptionsScene::dirtyRegions(std::vector<SDL_Rect>& rects) {
+  // Static screen: redraw only what a key press changed
+  if (!m_game) return false;
+  syncUi();
+  m_ui.damage(rects);
+  return true;
+}
+
+void OptionsScene::render(RenderQueue& q) {
+  if (!m_game) return;
+
+  q.clear(SDL_Color{ 16, 12, 20, 255 });
+  syncUi();
+  m_ui.render(q, RenderQueue::LayerWorld);
 }
@@ -3,6 +3,7 @@
 
 #include "Scene.h"
 #include "Game.h"
+#include "UiScreen.h"
 
 class OptionsScene : public Scene {
 public:
@@ -10,20 +11,30 @@ public:
 
   void handleEvent(const SDL_Event& e) override;
   void update(float dt) override;
-  void render(SDL_Renderer* r) override;
-
-private:
-  Game* m_game = nullptr; // not owned
+  void render(RenderQueue& q) override;
+  bool dirtyRegions(std::vector<SDL_Rect>& rects) override;
+  Uint32 idleTimeout() const override { return NO_DEADLINE; } // input-driven only
 
   // windowed resolutions to cycle with R
-  int m_resIndex = 0;
   static constexpr int RES_COUNT = 4;
-  const int m_resolutions[RES_COUNT][2] = {
+  static constexpr int RESOLUTIONS[RES_COUNT][2] = {
     { 960,  540 },
     { 1280, 720 },
     { 1600, 900 },
     { 1920, 1080 }
   };
 
+private:
+  Game* m_game = nullptr; // not owned
+
+  int m_resIndex = 0; // into RESOLUTIONS
+
+  UiScreen     m_ui;
+  UiScreen::Id m_list = -1;       // selectable settings
+  UiScreen::Id m_fullscreen = -1; // buttons in m_list
+  UiScreen::Id m_resolution = -1;
+
   void cycleResolution();
+  void activate(int index);
+  void syncUi(); // screen size and the settings shown
 };
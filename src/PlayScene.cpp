@@ -44,12 +44,7 @@ void PlayScene::clampToWindow(int w, int h) {
   m_player.y = std::max(0.f, std::min(m_player.y, (float)h - m_player.h));
 }
 
-void PlayScene::render(SDL_Renderer* r) {
-  if (!r) return;
-
-  SDL_SetRenderDrawColor(r, 12, 12, 16, 255);
-  SDL_RenderClear(r);
-
-  SDL_SetRenderDrawColor(r, 80, 180, 255, 255);
-  SDL_RenderFillRectF(r, &m_player);
+void PlayScene::render(RenderQueue& q) {
+  q.clear(SDL_Color{ 12, 12, 16, 255 });
+  q.fillRect(RenderQueue::LayerActors, m_player, SDL_Color{ 80, 180, 255, 255 });
 }
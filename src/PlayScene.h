@@ -10,7 +10,7 @@ public:
 
   void handleEvent(const SDL_Event& e) override;
   void update(float dt) override;
-  void render(SDL_Renderer* r) override;
+  void render(RenderQueue& q) override;
 
 private:
   Game* m_game = nullptr; // not owned
@@ -8,35 +8,32 @@
 #include <cstdlib>
 #include <string>
 
-// Small local text helper (so we don't need to change Text.h/Text.cpp)
-static void drawTextAt(SDL_Renderer* r, TTF_Font* font, const char* text, float x, float y) {
-  if (!r || !font || !text) return;
-
-  SDL_Color color{230, 235, 245, 255};
-  SDL_Surface* surf = TTF_RenderUTF8_Blended(font, text, color);
-  if (!surf) return;
-
-  SDL_Texture* tex = SDL_CreateTextureFromSurface(r, surf);
-  if (!tex) { SDL_FreeSurface(surf); return; }
-
-  SDL_FRect dst{ x, y, (float)surf->w, (float)surf->h };
-
-  SDL_FreeSurface(surf);
-  SDL_RenderCopyF(r, tex, nullptr, &dst);
-  SDL_DestroyTexture(tex);
-}
+// HUD line height at 960x540 (matches the 28 pt UI font); scales with height
+static constexpr float HUD_TEXT_PX = 33.f;
 
 RaceScene::RaceScene(Game* game) : m_game(game) {
   int w = 0, h = 0;
   if (m_game) m_game->getRenderSize(w, h);
   if (w <= 0 || h <= 0) { w = 960; h = 540; }
 
-  std::srand((unsigned)SDL_GetTicks());
+  std::srand(m_game ? m_game->randomSeed() : (unsigned)SDL_GetTicks());
+
+  if (m_game) {
+    m_sprCar = m_game->atlas().find("car");
+    m_sprTraffic = m_game->atlas().find("traffic");
+    m_sprObstacle = m_game->atlas().find("obstacle");
+    registerMarkerTexture();
+  }
 
   applyLevel(1, /*resetProgress=*/true);
   initCar(w, h);
 }
 
+RaceScene::~RaceScene() {
+  releaseRoadTiles(/*destroy=*/true);
+  if (m_game) m_game->textures().remove(m_markerTex);
+}
+
 void RaceScene::handleEvent(const SDL_Event& e) {
   if (!m_game) return;
 
@@ -91,6 +88,15 @@ RaceScene::LevelConfig RaceScene::getConfigForLevel(int level) const {
   float speedFactor = std::min(c.maxSpeed / 1200.f, 1.3f);
   c.minGapY = 140.f + 90.f * speedFactor;
 
+  // Road curves a little more every level; knots are 640 px apart, so this
+  // keeps the steepest bend within what the car can steer at full speed.
+  c.maxCurve = std::min(40.f + 12.f * (float)(L - 1), 120.f);
+
+  // AI traffic from level 2 on, always slower than the player's top speed
+  c.trafficCount = (L < 2) ? 0 : std::min(3 + 2 * (L - 2), 24);
+  c.trafficMinSpeed = 0.30f * c.maxSpeed;
+  c.trafficMaxSpeed = 0.50f * c.maxSpeed;
+
   // Obstacles slightly bigger over time
   c.obstacleW = std::min(72.f, 56.f + 2.f * (float)(L - 1));
   c.obstacleH = c.obstacleW;
@@ -112,11 +118,29 @@ void RaceScene::applyLevel(int level, bool resetProgress) {
   m_car.steer = 520.f;
 
   if (resetProgress) {
-    m_levelDistance = 0.f;
+    m_levelDistance = 0.0;
     m_spawnTimer = 0.f;
-    m_laneMarkerOffset = 0.f;
-    m_lastSpawnY = -10000.f;
-    m_lastLane = -1;
+    m_lastSpawnDistance = 0.0;
+    m_reach.reset(m_cfg.lanes);
+
+    RoadTrack::Params road{};
+    road.baseWidth = m_cfg.roadWidth;
+    road.minWidth = m_cfg.roadWidth * 0.9f;
+    road.maxOffset = m_cfg.maxCurve;
+    road.seed = (uint32_t)std::rand();
+    m_track.reset(road);
+    for (auto& tile : m_roadTiles) tile.segment = INT64_MIN; // new track
+
+    TrafficSim::Params traffic{};
+    traffic.lanes = m_cfg.lanes;
+    traffic.count = m_cfg.trafficCount;
+    traffic.minSpeed = m_cfg.trafficMinSpeed;
+    traffic.maxSpeed = m_cfg.trafficMaxSpeed;
+    traffic.behind = 1400.f; // below the bottom of the tallest screen
+    traffic.ahead = 3600.f;
+    traffic.seed = (uint32_t)std::rand();
+    m_traffic.reset(traffic, m_levelDistance);
+    m_stream.restart(m_cfg.lanes, (unsigned)std::rand());
     m_obs.clear();
     m_car.speed = 0.f;
     m_state = State::Racing;
@@ -126,17 +150,35 @@ void RaceScene::applyLevel(int level, bool resetProgress) {
 void RaceScene::initCar(int w, int h) {
   m_car.rect.w = 52.f;
   m_car.rect.h = 82.f;
-  m_car.rect.x = (w - m_car.rect.w) * 0.5f;
   m_car.rect.y = h - m_car.rect.h - 48.f;
   m_car.speed = 0.f;
 
+  // Start centered on the road under the car
+  double carY = worldYAt(m_car.rect.y + m_car.rect.h * 0.5f);
+  m_car.rect.x = (roadLeft(w, carY) + roadRight(w, carY) - m_car.rect.w) * 0.5f;
+
   // Clamp immediately in case road got narrower
   clampCarToRoad(w, h);
 }
 
-float RaceScene::roadLeft(int w) const  { return (w - m_cfg.roadWidth) * 0.5f; }
-float RaceScene::roadRight(int w) const { return roadLeft(w) + m_cfg.roadWidth; }
-float RaceScene::laneWidth() const      { return m_cfg.roadWidth / (float)std::max(1, m_cfg.lanes); }
+float RaceScene::roadLeft(int w, double worldY) const {
+  float width = m_track.width(worldY);
+
+  // Keep the whole road on screen even on narrow windows
+  float slack = std::max(0.f, (w - width) * 0.5f - 10.f);
+  float offset = std::max(-slack, std::min(m_track.centerOffset(worldY), slack));
+  return (w - width) * 0.5f + offset;
+}
+
+float RaceScene::roadRight(int w, double worldY) const {
+  return roadLeft(w, worldY) + m_track.width(worldY);
+}
+
+float RaceScene::laneWidthAt(double worldY) const {
+  return m_track.width(worldY) / (float)std::max(1, m_cfg.lanes);
+}
+
+float RaceScene::laneWidth() const { return m_cfg.roadWidth / (float)std::max(1, m_cfg.lanes); }
 
 int RaceScene::randInt(int minInclusive, int maxInclusive) {
   if (maxInclusive <= minInclusive) return minInclusive;
@@ -149,8 +191,9 @@ bool RaceScene::rectsOverlap(const SDL_FRect& a, const SDL_FRect& b) const {
 }
 
 void RaceScene::clampCarToRoad(int w, int) {
-  float left = roadLeft(w);
-  float right = roadRight(w);
+  double carY = worldYAt(m_car.rect.y + m_car.rect.h * 0.5f);
+  float left = roadLeft(w, carY);
+  float right = roadRight(w, carY);
 
   const float pad = 10.f;
   float minX = left + pad;
@@ -159,42 +202,123 @@ void RaceScene::clampCarToRoad(int w, int) {
   m_car.rect.x = std::max(minX, std::min(m_car.rect.x, maxX));
 }
 
+float RaceScene::steerSpeed() const {
+  float speedFactor = (m_car.maxSpeed > 1.f) ? (m_car.speed / m_car.maxSpeed) : 0.f;
+  return 200.f + m_car.steer * (0.35f + 0.65f * speedFactor);
+}
+
+int RaceScene::laneChangesWithin(float distance) const {
+  // Time to cover `distance` at the current speed, times lateral speed.
+  // A stopped car has all the time in the world.
+  const int lanes = std::max(1, m_cfg.lanes);
+  if (m_car.speed < 1.f) return lanes;
+
+  float lateral = steerSpeed() * (distance / m_car.speed);
+  float lanesCrossed = lateral / std::max(1.f, laneWidth());
+  return (int)std::min(lanesCrossed, (float)lanes);
+}
+
 void RaceScene::spawnObstacle(int w, int h) {
   (void)h;
 
-  // Always spawn at least one lane path remains (we spawn single obstacles only).
-  // Fairness is handled with minGapY + avoiding extreme lane jumps repeatedly.
+  // We spawn single obstacles only, so fairness comes from minGapY, avoiding
+  // extreme lane jumps repeatedly, and the reachability frontier below.
   const int lanes = std::max(1, m_cfg.lanes);
 
-  // Build lane choices with a tiny bias against repeating same lane too much
-  int lane = randInt(0, lanes - 1);
-  if (m_lastLane >= 0 && lanes > 1) {
-    // 60% chance: choose a different lane than last time
-    if ((std::rand() % 10) < 6) {
-      int tries = 0;
-      while (lane == m_lastLane && tries++ < 6) lane = randInt(0, lanes - 1);
+  // Lane pattern comes pre-generated from the stream; if the producer ever
+  // falls behind, just pick any lane here.
+  int lane = 0;
+  if (!m_stream.next(lane, m_game->deterministic()) || lane >= lanes) lane = randInt(0, lanes - 1);
+
+  // Reject lanes that would wall off every path from the previous row
+  int reach = laneChangesWithin((float)(m_levelDistance - m_lastSpawnDistance));
+  uint32_t safe = m_reach.safeToBlock(reach);
+  if (safe != 0u && (safe & (1u << lane)) == 0u) {
+    m_rejectedSpawns++;
+    std::printf(
+      "RaceScene: rejected unwinnable spawn (level %d, lane %d, frontier 0x%x, reach %d, total %d)\n",
+      m_level, lane, (unsigned)m_reach.frontier(), reach, m_rejectedSpawns
+    );
+
+    // Resample uniformly among the safe lanes
+    int count = 0;
+    for (int i = 0; i < lanes; i++) if (safe & (1u << i)) count++;
+    int pick = randInt(0, count - 1);
+    for (int i = 0; i < lanes; i++) {
+      if ((safe & (1u << i)) && pick-- == 0) { lane = i; break; }
     }
   }
-
-  float lw = laneWidth();
-  float left = roadLeft(w);
-  float laneCenter = left + lw * (lane + 0.5f);
+  m_reach.commit(lane, reach);
 
   Obstacle o{};
   o.lane = lane;
-  o.rect.w = m_cfg.obstacleW;
-  o.rect.h = m_cfg.obstacleH;
-  o.rect.x = laneCenter - o.rect.w * 0.5f;
-  o.rect.y = -o.rect.h - 10.f;
+  o.w = m_cfg.obstacleW;
+  o.h = m_cfg.obstacleH;
+  // just above the top of the screen
+  o.worldY = m_levelDistance + o.h + 10.0;
+
+  // Lane center where the obstacle's middle sits on the road
+  double midY = o.worldY - o.h * 0.5;
+  float laneCenter = roadLeft(w, midY) + laneWidthAt(midY) * (lane + 0.5f);
+  o.x = laneCenter - o.w * 0.5f;
 
   // Clamp inside road just in case
-  float minX = roadLeft(w) + 10.f;
-  float maxX = roadRight(w) - 10.f - o.rect.w;
-  o.rect.x = std::max(minX, std::min(o.rect.x, maxX));
+  float minX = roadLeft(w, midY) + 10.f;
+  float maxX = roadRight(w, midY) - 10.f - o.w;
+  o.x = std::max(minX, std::min(o.x, maxX));
 
   m_obs.push_back(o);
-  m_lastSpawnY = o.rect.y; // top of screen
-  m_lastLane = lane;
+  m_lastSpawnDistance = m_levelDistance;
+}
+
+SDL_FRect RaceScene::screenRect(const Obstacle& o) const {
+  return SDL_FRect{ o.x, (float)(m_levelDistance - o.worldY), o.w, o.h };
+}
+
+SDL_FRect RaceScene::screenRect(const TrafficSim::Car& c, int w) const {
+  const float len = m_traffic.carLength();
+  const float cw = 46.f;
+
+  double midY = c.y - len * 0.5;
+  float x = roadLeft(w, midY) + laneWidthAt(midY) * (c.laneF + 0.5f) - cw * 0.5f;
+  return SDL_FRect{ x, (float)(m_levelDistance - c.y), cw, len };
+}
+
+void RaceScene::feedTrafficBlockers(int w) {
+  if (m_traffic.cars().empty()) return; // no traffic on this level
+
+  // Static obstacles
+  for (const auto& o : m_obs) {
+    m_traffic.addBlocker(TrafficSim::Blocker{ o.worldY, o.h, 0.f, o.lane });
+  }
+
+  // The player, in every lane the car body covers
+  double front = worldYAt(m_car.rect.y);
+  double mid = front - m_car.rect.h * 0.5;
+  float left = roadLeft(w, mid);
+  float lw = std::max(1.f, laneWidthAt(mid));
+  int laneA = (int)std::floor((m_car.rect.x - left) / lw);
+  int laneB = (int)std::floor((m_car.rect.x + m_car.rect.w - left) / lw);
+  laneA = std::max(0, std::min(laneA, m_cfg.lanes - 1));
+  laneB = std::max(0, std::min(laneB, m_cfg.lanes - 1));
+  for (int lane = laneA; lane <= laneB; lane++) {
+    m_traffic.addBlocker(TrafficSim::Blocker{ front, m_car.rect.h, m_car.speed, lane });
+  }
+}
+
+void RaceScene::visibleRange(float y0, float y1, std::size_t& first, std::size_t& last) const {
+  // Screen span of o is [cam - worldY, cam - worldY + h). It meets [y0, y1)
+  // when cam - y1 < worldY < cam - y0 + h. All obstacles in a level share h.
+  const double lo = m_levelDistance - y1;
+  const double hi = m_levelDistance - y0 + m_cfg.obstacleH;
+
+  auto byWorldY = [](const Obstacle& o, double y) { return o.worldY <= y; };
+  auto begin = std::lower_bound(m_obs.begin(), m_obs.end(), lo, byWorldY);
+  auto end   = std::lower_bound(begin, m_obs.end(), hi,
+    [](const Obstacle& o, double y) { return o.worldY < y; });
+
+  first = (std::size_t)(begin - m_obs.begin());
+  last  = (std::size_t)(end - m_obs.begin());
 }
 
 void RaceScene::update(float dt) {
@@ -235,37 +359,30 @@ void RaceScene::update(float dt) {
   if (left) steerDir -= 1.f;
   if (right) steerDir += 1.f;
 
-  float speedFactor = (m_car.maxSpeed > 1.f) ? (m_car.speed / m_car.maxSpeed) : 0.f;
-  float steerPxPerSec = 200.f + m_car.steer * (0.35f + 0.65f * speedFactor);
-  m_car.rect.x += steerDir * steerPxPerSec * dt;
+  m_car.rect.x += steerDir * steerSpeed() * dt;
 
   clampCarToRoad(w, h);
 
-  // --- World scroll ---
-  m_laneMarkerOffset += m_car.speed * dt;
-  const float markerPeriod = 80.f;
-  if (m_laneMarkerOffset >= markerPeriod) m_laneMarkerOffset = std::fmod(m_laneMarkerOffset, markerPeriod);
+  // --- World scroll (camera only; obstacles stay put in world space) ---
+  m_levelDistance += m_car.speed * dt;
 
-  for (auto& o : m_obs) o.rect.y += m_car.speed * dt;
+  // Bake road segments from below the screen to just past the spawn row
+  m_track.prepare(worldYAt((float)h + 120.f), worldYAt(-240.f));
 
-  // Remove obstacles off screen
-  m_obs.erase(
-    std::remove_if(m_obs.begin(), m_obs.end(), [&](const Obstacle& o) {
-      return o.rect.y > (float)h + 120.f;
-    }),
-    m_obs.end()
-  );
+  // Remove obstacles off screen (oldest are at the front)
+  while (!m_obs.empty() && screenRect(m_obs.front()).y > (float)h + 120.f) m_obs.pop_front();
+
+  // --- Traffic ---
+  feedTrafficBlockers(w);
+  m_traffic.update(dt, m_levelDistance);
 
   // --- Spawn logic ---
   m_spawnTimer += dt;
 
   // Additional fairness: require enough vertical spacing between consecutive obstacles
   // (since they spawn above screen at similar y, spacing is effectively time-based)
-  // We check the "highest" (smallest y) obstacle currently alive.
-  float highestY = 999999.f;
-  for (const auto& o : m_obs) highestY = std::min(highestY, o.rect.y);
-
-  bool spacingOK = (m_obs.empty()) || (highestY > m_cfg.minGapY);
+  // We check the "highest" (smallest y) obstacle currently alive, i.e. the newest.
+  bool spacingOK = (m_obs.empty()) || (screenRect(m_obs.back()).y > m_cfg.minGapY);
 
   if (m_spawnTimer >= m_cfg.spawnInterval && spacingOK) {
     m_spawnTimer = 0.f;
@@ -273,7 +390,6 @@ void RaceScene::update(float dt) {
   }
 
   // --- Progress ---
-  m_levelDistance += m_car.speed * dt;
   if (m_levelDistance >= m_cfg.targetDistance) {
     m_state = State::LevelComplete;
     // Freeze speed for nicer finish
@@ -281,93 +397,307 @@ void RaceScene::update(float dt) {
   }
 
   // --- Collisions (FAIL) ---
-  for (const auto& o : m_obs) {
-    if (rectsOverlap(m_car.rect, o.rect)) {
+  std::size_t first = 0, last = 0;
+  visibleRange(m_car.rect.y, m_car.rect.y + m_car.rect.h, first, last);
+  for (std::size_t i = first; i < last; i++) {
+    if (rectsOverlap(m_car.rect, screenRect(m_obs[i]))) {
       m_state = State::GameOver;
       m_car.speed = 0.f;
       break;
     }
   }
+
+  if (m_state == State::Racing) {
+    double carTop = worldYAt(m_car.rect.y);
+    double carBottom = worldYAt(m_car.rect.y + m_car.rect.h);
+    m_traffic.forEachInRange(carBottom, carTop, [&](const TrafficSim::Car& c) {
+      if (rectsOverlap(m_car.rect, screenRect(c, w))) m_state = State::GameOver;
+    });
+    if (m_state == State::GameOver) m_car.speed = 0.f;
+  }
 }
 
-void RaceScene::render(SDL_Renderer* r) {
-  if (!m_game || !r) return;
+void RaceScene::buildRoadStrip(int w, double worldTop, float height) {
+  // One triangle strip from y = 0 (worldTop) down to `height`, a row every 10 px
+  const float rowStep = 10.f;
+  const int rows = (int)std::ceil(height / rowStep);
+  m_roadVerts.clear();
+  m_roadIdx.clear();
+  m_edgeLeft.clear();
+  m_edgeRight.clear();
+
+  const SDL_Color roadColor { 26, 26, 32, 255 };
+  for (int i = 0; i <= rows; i++) {
+    float y = std::min(i * rowStep, height);
+    double wy = worldTop - y;
+    float left = roadLeft(w, wy);
+    float right = roadRight(w, wy);
+
+    m_roadVerts.push_back(SDL_Vertex{ { left, y }, roadColor, { 0.f, 0.f } });
+    m_roadVerts.push_back(SDL_Vertex{ { right, y }, roadColor, { 0.f, 0.f } });
+    m_edgeLeft.push_back(SDL_FPoint{ left, y });
+    m_edgeRight.push_back(SDL_FPoint{ right, y });
+
+    if (i > 0) {
+      int base = (i - 1) * 2;
+      int quad[6] = { base, base + 1, base + 2, base + 1, base + 3, base + 2 };
+      m_roadIdx.insert(m_roadIdx.end(), quad, quad + 6);
+    }
+  }
+}
 
-  int w = 0, h = 0;
-  m_game->getRenderSize(w, h);
+void RaceScene::releaseRoadTiles(bool destroy) {
+  for (auto& tile : m_roadTiles) {
+    if (destroy && tile.tex) SDL_DestroyTexture(tile.tex);
+    tile.tex = nullptr;
+    tile.segment = INT64_MIN;
+  }
+  m_roadTilesRenderer = nullptr;
+  m_roadTilesW = 0;
+}
 
-  // Background
-  SDL_SetRenderDrawColor(r, 10, 10, 14, 255);
-  SDL_RenderClear(r);
+bool RaceScene::prepareRoadTiles(SDL_Renderer* r, int w, int h) {
+  if (!r || w <= 0 || h <= 0) return false;
 
-  // Road
-  SDL_FRect road { roadLeft(w), 0.f, m_cfg.roadWidth, (float)h };
-  SDL_SetRenderDrawColor(r, 26, 26, 32, 255);
-  SDL_RenderFillRectF(r, &road);
+  // Renderer recreated: SDL already freed the old textures with it
+  if (m_roadTilesRenderer &&
+      (m_roadTilesRenderer != r || m_roadTilesRendererGen != m_game->rendererGeneration())) {
+    releaseRoadTiles(/*destroy=*/false);
+  }
+
+  // Contents lost, or tiles sized for another width: start over
+  if (m_roadTilesRenderer &&
+      (m_roadTilesTargetsGen != m_game->targetsGeneration() || m_roadTilesW != w)) {
+    releaseRoadTiles(/*destroy=*/true);
+  }
 
-  // Road edge lines
-  SDL_SetRenderDrawColor(r, 60, 60, 72, 255);
-  SDL_RenderDrawLineF(r, road.x, 0.f, road.x, (float)h);
-  SDL_RenderDrawLineF(r, road.x + road.w, 0.f, road.x + road.w, (float)h);
+  if (!m_roadTilesRenderer) {
+    if (!SDL_RenderTargetSupported(r)) return false;
 
-  // Lane markers
-  SDL_SetRenderDrawColor(r, 210, 210, 220, 220);
-  float lw = laneWidth();
+    for (auto& tile : m_roadTiles) {
+      tile.tex = SDL_CreateTexture(r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                   w, RoadTrack::SEGMENT_LENGTH);
+      if (!tile.tex) {
+        releaseRoadTiles(/*destroy=*/true);
+        return false;
+      }
+      // Tiles are opaque and cover the whole screen: plain copies, no blending
+      SDL_SetTextureBlendMode(tile.tex, SDL_BLENDMODE_NONE);
+    }
+    m_roadTilesRenderer = r;
+    m_roadTilesRendererGen = m_game->rendererGeneration();
+    m_roadTilesTargetsGen = m_game->targetsGeneration();
+    m_roadTilesW = w;
+  }
+
+  // Draw any visible segment that isn't cached yet
+  const double len = RoadTrack::SEGMENT_LENGTH;
+  const int64_t top = (int64_t)std::floor(m_levelDistance / len);
+  const int64_t bottom = (int64_t)std::floor(worldYAt((float)h) / len);
+  if (top - bottom + 1 > ROAD_TILES) return false;
+
+  SDL_Texture* prevTarget = SDL_GetRenderTarget(r);
+  for (int64_t k = bottom; k <= top; k++) {
+    RoadTile& tile = m_roadTiles[(int)(((k % ROAD_TILES) + ROAD_TILES) % ROAD_TILES)];
+    if (tile.segment == k) continue;
+
+    buildRoadStrip(w, (double)(k + 1) * len, (float)len);
+
+    SDL_SetRenderTarget(r, tile.tex);
+    SDL_SetRenderDrawColor(r, 10, 10, 14, 255);
+    SDL_RenderClear(r);
+    SDL_RenderGeometry(r, nullptr,
+      m_roadVerts.data(), (int)m_roadVerts.size(),
+      m_roadIdx.data(), (int)m_roadIdx.size());
+    SDL_SetRenderDrawColor(r, 60, 60, 72, 255);
+    SDL_RenderDrawLinesF(r, m_edgeLeft.data(), (int)m_edgeLeft.size());
+    SDL_RenderDrawLinesF(r, m_edgeRight.data(), (int)m_edgeRight.size());
+
+    tile.segment = k;
+  }
+  SDL_SetRenderTarget(r, prevTarget);
+  return true;
+}
+
+void RaceScene::recordRoad(RenderQueue& q, int w, int h) {
+  const uint8_t roadLayer = RenderQueue::LayerWorld;
+
+  // The CPU rasterizer can't read render targets back, and redrawing the
+  // strip there costs about the same as blitting a tile
+  if (!m_game->softRaster() && prepareRoadTiles(m_game->renderer(), w, h)) {
+    // Tiles cover the full screen, so no clear is needed
+    const double len = RoadTrack::SEGMENT_LENGTH;
+    const int64_t top = (int64_t)std::floor(m_levelDistance / len);
+    const int64_t bottom = (int64_t)std::floor(worldYAt((float)h) / len);
+    for (int64_t k = bottom; k <= top; k++) {
+      const RoadTile& tile = m_roadTiles[(int)(((k % ROAD_TILES) + ROAD_TILES) % ROAD_TILES)];
+      // Whole pixels; every tile has the same fraction so they stay seamless
+      float y = (float)std::floor(m_levelDistance - (double)(k + 1) * len);
+      q.texture(roadLayer, tile.tex, nullptr, SDL_FRect{ 0.f, y, (float)w, (float)len });
+    }
+    return;
+  }
+
+  // No render targets: draw the road from primitives every frame
+  q.clear(SDL_Color{ 10, 10, 14, 255 });
+
+  buildRoadStrip(w, m_levelDistance, (float)h);
+  q.geometry(roadLayer, nullptr,
+    m_roadVerts.data(), (int)m_roadVerts.size(),
+    m_roadIdx.data(), (int)m_roadIdx.size());
+
+  const SDL_Color edgeColor { 60, 60, 72, 255 };
+  q.polyline(roadLayer + 1, m_edgeLeft.data(), (int)m_edgeLeft.size(), edgeColor);
+  q.polyline(roadLayer + 1, m_edgeRight.data(), (int)m_edgeRight.size(), edgeColor);
+}
+
+void RaceScene::registerMarkerTexture() {
+  // 8x34 dash: 6 px body plus a soft 1 px edge each side
+  m_markerTex = m_game->textures().add(8, 34, [](uint32_t* pixels, int tw, int th) {
+    for (int y = 0; y < th; y++) {
+      for (int x = 0; x < tw; x++) {
+        Uint32 a = (x == 0 || x == tw - 1) ? 90u : 220u;
+        pixels[y * tw + x] = (a << 24) | (210u << 16) | (210u << 8) | 220u; // ARGB
+      }
+    }
+  });
+}
+
+void RaceScene::recordLaneMarkers(RenderQueue& q, int w, int h) {
+  const uint8_t markLayer = RenderQueue::LayerWorld + 1;
+
+  // Dashes sit at fixed world positions: one every 80 px, 34 px long.
+  // Each becomes a textured quad bent along the divider, and the whole set
+  // is a single geometry command (one draw call after batching).
+  const float markerOffset = (float)std::fmod(m_levelDistance, 80.0);
+  SDL_Texture* tex = m_game->textures().get(m_markerTex);
+
+  if (!tex) {
+    const SDL_Color dashColor { 210, 210, 220, 220 };
+    for (int lane = 1; lane < m_cfg.lanes; lane++) {
+      for (float y = -80.f + markerOffset; y < h + 80.f; y += 80.f) {
+        double wy = worldYAt(y + 17.f);
+        float x = roadLeft(w, wy) + laneWidthAt(wy) * lane;
+        q.fillRect(markLayer, SDL_FRect{ x - 3.f, y, 6.f, 34.f }, dashColor);
+      }
+    }
+    return;
+  }
+
+  m_markerVerts.clear();
+  m_markerIdx.clear();
+
+  const SDL_Color white { 255, 255, 255, 255 };
+  const float half = 4.f;
   for (int lane = 1; lane < m_cfg.lanes; lane++) {
-    float x = road.x + lw * lane;
-    for (float y = -80.f + m_laneMarkerOffset; y < h + 80.f; y += 80.f) {
-      SDL_FRect dash { x - 3.f, y, 6.f, 34.f };
-      SDL_RenderFillRectF(r, &dash);
+    for (float y = -80.f + markerOffset; y < h + 80.f; y += 80.f) {
+      double top = worldYAt(y);
+      double bottom = worldYAt(y + 34.f);
+      float xTop = roadLeft(w, top) + laneWidthAt(top) * lane;
+      float xBottom = roadLeft(w, bottom) + laneWidthAt(bottom) * lane;
+
+      int base = (int)m_markerVerts.size();
+      m_markerVerts.push_back(SDL_Vertex{ { xTop - half, y },           white, { 0.f, 0.f } });
+      m_markerVerts.push_back(SDL_Vertex{ { xTop + half, y },           white, { 1.f, 0.f } });
+      m_markerVerts.push_back(SDL_Vertex{ { xBottom - half, y + 34.f }, white, { 0.f, 1.f } });
+      m_markerVerts.push_back(SDL_Vertex{ { xBottom + half, y + 34.f }, white, { 1.f, 1.f } });
+
+      int quad[6] = { base, base + 1, base + 2, base + 1, base + 3, base + 2 };
+      m_markerIdx.insert(m_markerIdx.end(), quad, quad + 6);
     }
   }
 
+  q.geometry(markLayer, tex,
+    m_markerVerts.data(), (int)m_markerVerts.size(),
+    m_markerIdx.data(), (int)m_markerIdx.size());
+}
+
+bool RaceScene::recordSprite(RenderQueue& q, int sprite, const SDL_FRect& dst) {
+  SDL_Vertex v[4];
+  SDL_Texture* tex = m_game->atlas().quad(sprite, dst, v);
+  if (!tex) return false;
+
+  // Same texture + layer: the queue merges these into one draw call and
+  // keeps submission order, so later sprites still paint over earlier ones.
+  q.geometry(RenderQueue::LayerActors + 1, tex, v, 4, SpriteAtlas::QUAD_INDICES, 6);
+  return true;
+}
+
+void RaceScene::render(RenderQueue& q) {
+  if (!m_game) return;
+
+  int w = 0, h = 0;
+  m_game->getRenderSize(w, h);
+
+  const uint8_t obsLayer    = RenderQueue::LayerActors;
+  const uint8_t bodyLayer   = RenderQueue::LayerActors + 1;
+  const uint8_t detailLayer = RenderQueue::LayerActors + 2;
+
+  // Background, road surface and edges
+  recordRoad(q, w, h);
+
+  // Lane markers
+  recordLaneMarkers(q, w, h);
+
   // Obstacles
-  SDL_SetRenderDrawColor(r, 240, 90, 90, 255);
-  for (const auto& o : m_obs) SDL_RenderFillRectF(r, &o.rect);
+  std::size_t first = 0, last = 0;
+  visibleRange(0.f, (float)h, first, last);
+  for (std::size_t i = first; i < last; i++) {
+    SDL_FRect rect = screenRect(m_obs[i]);
+    if (!recordSprite(q, m_sprObstacle, rect)) q.fillRect(obsLayer, rect, SDL_Color{ 240, 90, 90, 255 });
+  }
+
+  // Traffic
+  const SDL_Color glassColor { 10, 10, 14, 160 };
+  m_traffic.forEachInRange(worldYAt((float)h), worldYAt(0.f), [&](const TrafficSim::Car& c) {
+    SDL_FRect body = screenRect(c, w);
+    if (recordSprite(q, m_sprTraffic, body)) return;
+    q.fillRect(bodyLayer, body, SDL_Color{ 235, 190, 70, 255 });
+    q.fillRect(detailLayer, SDL_FRect{ body.x + 8.f, body.y + 12.f, body.w - 16.f, 16.f }, glassColor);
+  });
 
   // Car
-  SDL_SetRenderDrawColor(r, 80, 180, 255, 255);
-  SDL_RenderFillRectF(r, &m_car.rect);
-  SDL_FRect win { m_car.rect.x + 10.f, m_car.rect.y + 12.f, m_car.rect.w - 20.f, 18.f };
-  SDL_SetRenderDrawColor(r, 10, 10, 14, 160);
-  SDL_RenderFillRectF(r, &win);
-
-  // HUD
-  TTF_Font* font = m_game->font();
-  if (font) {
-    char hud[192];
-    std::snprintf(
-      hud, sizeof(hud),
-      "Level %d   Distance: %d / %d",
-      m_level,
-      (int)m_levelDistance,
-      (int)m_cfg.targetDistance
-    );
+  if (!recordSprite(q, m_sprCar, m_car.rect)) {
+    q.fillRect(bodyLayer, m_car.rect, SDL_Color{ 80, 180, 255, 255 });
+    SDL_FRect win { m_car.rect.x + 10.f, m_car.rect.y + 12.f, m_car.rect.w - 20.f, 18.f };
+    q.fillRect(detailLayer, win, glassColor);
+  }
 
+  // HUD (scales with the window: text comes from the distance-field font)
+  SdfFont& text = m_game->sdfFont();
+  const float ui = (float)h / 540.f;
+  const float textPx = std::round(HUD_TEXT_PX * ui);
+  const SDL_Color textColor { 230, 235, 245, 255 };
+  if (text.ready()) {
     // subtle panel behind HUD
-    SDL_FRect hudPanel { 16.f, 12.f, 520.f, 44.f };
-    SDL_SetRenderDrawColor(r, 12, 12, 16, 180);
-    SDL_RenderFillRectF(r, &hudPanel);
-    SDL_SetRenderDrawColor(r, 60, 60, 72, 220);
-    SDL_RenderDrawRectF(r, &hudPanel);
-
-    drawTextAt(r, font, hud, hudPanel.x + 14.f, hudPanel.y + 10.f);
+    SDL_FRect hudPanel { 16.f * ui, 12.f * ui, 520.f * ui, 44.f * ui };
+    q.fillRect(RenderQueue::LayerHud, hudPanel, SDL_Color{ 12, 12, 16, 180 });
+    q.drawRect(RenderQueue::LayerHud + 1, hudPanel, SDL_Color{ 60, 60, 72, 220 });
+
+    // Distance changes every tick: fixed labels plus to_chars digits, no
+    // per-frame formatting, layout or allocation
+    m_hud.begin(q, text, RenderQueue::LayerHud + 2,
+                hudPanel.x + 14.f * ui, hudPanel.y + 10.f * ui, textPx, textColor);
+    m_hud.label("Level ").number(m_level)
+         .label("   Distance: ").number((long long)m_levelDistance)
+         .label(" / ").number((long long)m_cfg.targetDistance);
   }
 
   // Overlays
-  if (font && (m_state == State::GameOver || m_state == State::LevelComplete)) {
-    SDL_FRect overlay { (w - 520.f) * 0.5f, (h - 220.f) * 0.5f, 520.f, 220.f };
-    SDL_SetRenderDrawColor(r, 12, 12, 16, 220);
-    SDL_RenderFillRectF(r, &overlay);
-    SDL_SetRenderDrawColor(r, 80, 180, 255, 255);
-    SDL_RenderDrawRectF(r, &overlay);
+  if (text.ready() && (m_state == State::GameOver || m_state == State::LevelComplete)) {
+    SDL_FRect overlay { (w - 520.f * ui) * 0.5f, (h - 220.f * ui) * 0.5f, 520.f * ui, 220.f * ui };
+    q.fillRect(RenderQueue::LayerOverlay, overlay, SDL_Color{ 12, 12, 16, 220 });
+    q.drawRect(RenderQueue::LayerOverlay + 1, overlay, SDL_Color{ 80, 180, 255, 255 });
 
     const char* title = (m_state == State::GameOver) ? "CRASHED!" : "LEVEL COMPLETE!";
     const char* hint  = (m_state == State::GameOver)
       ? "Press Enter to retry this level"
       : "Press Enter to start next level";
 
-    drawTextAt(r, font, title, overlay.x + 150.f, overlay.y + 50.f);
-    drawTextAt(r, font, hint,  overlay.x + 85.f,  overlay.y + 130.f);
+    // Measured layouts (cached), centered; the hint wraps if it must
+    const SDL_FRect titleBox { overlay.x, overlay.y + 30.f * ui, overlay.w, 70.f * ui };
+    const SDL_FRect hintBox { overlay.x + 24.f * ui, overlay.y + 110.f * ui, overlay.w - 48.f * ui, 80.f * ui };
+    text.drawCentered(q, RenderQueue::LayerOverlay + 2, title, titleBox, textPx, textColor);
+    text.drawCentered(q, RenderQueue::LayerOverlay + 2, hint, hintBox, textPx, textColor);
   }
 }
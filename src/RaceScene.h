@@ -3,8 +3,15 @@
 
 #include "Scene.h"
 #include "Game.h"
+#include "HudLine.h"
+#include "LaneReachability.h"
+#include "ObstacleStream.h"
+#include "RoadTrack.h"
+#include "TrafficSim.h"
 
 #include <SDL2/SDL.h>
+#include <cstddef>
+#include <deque>
 #include <vector>
 
 // Top-down racing (LEVEL-BASED):
@@ -19,17 +26,22 @@
 class RaceScene : public Scene {
 public:
   explicit RaceScene(Game* game);
+  ~RaceScene() override;
 
   void handleEvent(const SDL_Event& e) override;
   void update(float dt) override;
-  void render(SDL_Renderer* r) override;
+  void render(RenderQueue& q) override;
+
+  // The crash / level-complete overlays are static until a key press
+  Uint32 idleTimeout() const override { return m_state == State::Racing ? 0 : NO_DEADLINE; }
 
 private:
   enum class State { Racing, LevelComplete, GameOver };
 
   struct LevelConfig {
     float targetDistance;     // "meters" in px-equivalent
-    float roadWidth;
+    float roadWidth;          // widest the road gets (it narrows to 90%)
+    float maxCurve;           // max road center drift from screen center (px)
     int   lanes;
 
     float maxSpeed;
@@ -38,6 +50,10 @@ private:
 
     float obstacleW;
     float obstacleH;
+
+    int   trafficCount;       // AI cars in the simulated window
+    float trafficMinSpeed;    // px/s
+    float trafficMaxSpeed;
   };
 
   struct Car {
@@ -52,9 +68,15 @@ private:
     float steer = 520.f;      // px/s at full speed factor
   };
 
+  // Obstacles live in world space and never move after spawning.
+  // worldY is the level distance at which the obstacle's top edge reaches the
+  // top of the screen; screen y = m_levelDistance - worldY.
   struct Obstacle {
-    SDL_FRect rect;
-    int lane = 0;
+    double worldY = 0.0;
+    float  x = 0.f;
+    float  w = 0.f;
+    float  h = 0.f;
+    int    lane = 0;
   };
 
   Game* m_game = nullptr;
@@ -64,19 +86,61 @@ private:
   int   m_level = 1;
 
   LevelConfig m_cfg{};
-  float m_levelDistance = 0.f;
+  double m_levelDistance = 0.0; // doubles as the camera position
+
+  // Curved road, generated lazily around the camera
+  RoadTrack m_track;
 
-  // Road visuals
-  float m_laneMarkerOffset = 0.f;
+  // AI traffic (IDM car-following + lane changes)
+  TrafficSim m_traffic;
 
-  // Car + obstacles
+  // Road surface pre-rendered per track segment into target textures, so a
+  // frame is a few blits instead of re-filling the road. A tile depends on
+  // the level's track, the output width and the renderer, so any change
+  // there rebuilds the tiles.
+  struct RoadTile {
+    SDL_Texture* tex = nullptr;
+    int64_t      segment = INT64_MIN;
+  };
+  static constexpr int ROAD_TILES = 4; // covers a 1080 px screen + 1 spare
+  RoadTile      m_roadTiles[ROAD_TILES];
+  SDL_Renderer* m_roadTilesRenderer = nullptr;
+  unsigned      m_roadTilesRendererGen = 0;
+  unsigned      m_roadTilesTargetsGen = 0;
+  int           m_roadTilesW = 0;
+
+  // Lane dash sprite; all dividers go out as one textured geometry batch
+  TextureRegistry::Handle m_markerTex = 0;
+  std::vector<SDL_Vertex> m_markerVerts;
+  std::vector<int>        m_markerIdx;
+
+  HudLine m_hud;
+
+  // Atlas sprite ids (-1 = not packed; draw flat rects instead)
+  int m_sprCar = -1;
+  int m_sprTraffic = -1;
+  int m_sprObstacle = -1;
+
+  // Road geometry scratch buffers (reused every frame)
+  std::vector<SDL_Vertex> m_roadVerts;
+  std::vector<int>        m_roadIdx;
+  std::vector<SDL_FPoint> m_edgeLeft;
+  std::vector<SDL_FPoint> m_edgeRight;
+
+  // Car + obstacles (m_obs is sorted by worldY since spawns only go forward)
   Car m_car{};
-  std::vector<Obstacle> m_obs;
+  std::deque<Obstacle> m_obs;
 
   // Spawning
   float m_spawnTimer = 0.f;
-  float m_lastSpawnY = -10000.f; // last spawned obstacle y (world space in screen coords)
-  int   m_lastLane = -1;
+  double m_lastSpawnDistance = 0.0; // m_levelDistance at the last spawn
+
+  // Upcoming lane choices, generated on a background thread
+  ObstacleStream m_stream;
+
+  // Fairness: lanes still reachable at the last spawned row
+  LaneReachability m_reach;
+  int m_rejectedSpawns = 0;
 
 private:
   // Level helpers
@@ -85,13 +149,32 @@ private:
 
   // Scene helpers
   void initCar(int w, int h);
-  float roadLeft(int w) const;
-  float roadRight(int w) const;
-  float laneWidth() const;
+  double worldYAt(float screenY) const { return m_levelDistance - screenY; }
+  float roadLeft(int w, double worldY) const;
+  float roadRight(int w, double worldY) const;
+  float laneWidthAt(double worldY) const;
+  float laneWidth() const; // widest lane (nominal road width)
 
   void clampCarToRoad(int w, int h);
+  float steerSpeed() const;                   // lateral px/s at current speed
+  int laneChangesWithin(float distance) const; // lanes the car can cross in `distance`
 
   void spawnObstacle(int w, int h);
+  SDL_FRect screenRect(const Obstacle& o) const;
+  SDL_FRect screenRect(const TrafficSim::Car& c, int w) const;
+  void feedTrafficBlockers(int w);
+
+  // Road rendering
+  void buildRoadStrip(int w, double worldTop, float height);
+  void releaseRoadTiles(bool destroy);
+  bool prepareRoadTiles(SDL_Renderer* r, int w, int h);
+  void recordRoad(RenderQueue& q, int w, int h);
+  void registerMarkerTexture();
+  void recordLaneMarkers(RenderQueue& q, int w, int h);
+  // Atlas sprite on the actor layer; false if the sprite isn't available
+  bool recordSprite(RenderQueue& q, int sprite, const SDL_FRect& dst);
+  // [first, last) of obstacles whose screen span intersects [y0, y1)
+  void visibleRange(float y0, float y1, std::size_t& first, std::size_t& last) const;
   bool rectsOverlap(const SDL_FRect& a, const SDL_FRect& b) const;
 
   int randInt(int minInclusive, int maxInclusive);
@@ -0,0 +1,305 @@
+// src/RenderQueue.cpp
+#include "RenderQueue.h"
+
+#include <algorithm>
+#include <cmath>
+
+#include "SoftRaster.h"
+
+uint64_t RenderQueue::makeKey(uint8_t layer, Kind kind, uint64_t material) {
+  // [63..56] layer  [55..52] kind  [51..0] material
+  return ((uint64_t)layer << 56) |
+         ((uint64_t)kind << 52) |
+         (material & ((1ull << 52) - 1));
+}
+
+uint64_t RenderQueue::colorMaterial(SDL_Color c) {
+  return ((uint64_t)c.r << 24) | ((uint64_t)c.g << 16) | ((uint64_t)c.b << 8) | c.a;
+}
+
+uint64_t RenderQueue::pointerMaterial(const void* p) {
+  return (uint64_t)(uintptr_t)p;
+}
+
+void RenderQueue::begin() {
+  m_stats = Stats{};
+  m_sorted = false;
+  m_cmds.clear();
+  m_points.clear();
+  m_verts.clear();
+  m_indices.clear();
+}
+
+RenderQueue::Command& RenderQueue::push(uint8_t layer, Kind kind, uint64_t material) {
+  Command c{};
+  c.key = makeKey(layer, kind, material);
+  c.seq = (uint32_t)m_cmds.size();
+  c.kind = kind;
+  m_cmds.push_back(c);
+  m_sorted = false;
+  return m_cmds.back();
+}
+
+void RenderQueue::clear(SDL_Color c) {
+  // Kind::Clear is 0, so this sorts ahead of everything in layer 0
+  push(LayerBackground, Kind::Clear, 0).color = c;
+}
+
+void RenderQueue::fillRect(uint8_t layer, const SDL_FRect& rect, SDL_Color c) {
+  Command& cmd = push(layer, Kind::FillRect, colorMaterial(c));
+  cmd.color = c;
+  cmd.rect = rect;
+}
+
+void RenderQueue::drawRect(uint8_t layer, const SDL_FRect& rect, SDL_Color c) {
+  Command& cmd = push(layer, Kind::DrawRect, colorMaterial(c));
+  cmd.color = c;
+  cmd.rect = rect;
+}
+
+void RenderQueue::line(uint8_t layer, float x1, float y1, float x2, float y2, SDL_Color c) {
+  Command& cmd = push(layer, Kind::Line, colorMaterial(c));
+  cmd.color = c;
+  cmd.rect = SDL_FRect{ x1, y1, x2, y2 }; // endpoints, not a rect
+}
+
+void RenderQueue::polyline(uint8_t layer, const SDL_FPoint* points, int count, SDL_Color c) {
+  if (!points || count < 2) return;
+
+  Command& cmd = push(layer, Kind::Polyline, colorMaterial(c));
+  cmd.color = c;
+  cmd.first = (uint32_t)m_points.size();
+  cmd.count = (uint32_t)count;
+  m_points.insert(m_points.end(), points, points + count);
+}
+
+void RenderQueue::geometry(uint8_t layer, SDL_Texture* tex,
+                           const SDL_Vertex* verts, int vertCount,
+                           const int* indices, int indexCount) {
+  if (!verts || vertCount <= 0) return;
+
+  Command& cmd = push(layer, Kind::Geometry, pointerMaterial(tex));
+  cmd.tex = tex;
+  cmd.first = (uint32_t)m_verts.size();
+  cmd.count = (uint32_t)vertCount;
+  m_verts.insert(m_verts.end(), verts, verts + vertCount);
+
+  cmd.indexFirst = (uint32_t)m_indices.size();
+  if (indices && indexCount > 0) {
+    cmd.indexCount = (uint32_t)indexCount;
+    m_indices.insert(m_indices.end(), indices, indices + indexCount);
+  } else {
+    // Unindexed triangles: synthesize 0..n-1 so batches can be merged
+    cmd.indexCount = (uint32_t)vertCount;
+    for (int i = 0; i < vertCount; i++) m_indices.push_back(i);
+  }
+}
+
+void RenderQueue::texture(uint8_t layer, SDL_Texture* tex, const SDL_Rect* src, const SDL_FRect& dst) {
+  if (!tex) return;
+
+  Command& cmd = push(layer, Kind::Texture, pointerMaterial(tex));
+  cmd.tex = tex;
+  cmd.rect = dst;
+  if (src) {
+    cmd.src = *src;
+    cmd.hasSrc = true;
+  }
+}
+
+void RenderQueue::submitRun(SDL_Renderer* r, size_t begin, size_t end) {
+  const Kind kind = m_cmds[begin].kind;
+
+  switch (kind) {
+    case Kind::Clear:
+      for (size_t i = begin; i < end; i++) {
+        if (m_hasClip) SDL_RenderFillRect(r, &m_clip);
+        else           SDL_RenderClear(r);
+        m_stats.flushes++;
+      }
+      break;
+
+    case Kind::FillRect:
+    case Kind::DrawRect: {
+      m_rects.clear();
+      for (size_t i = begin; i < end; i++) m_rects.push_back(m_cmds[i].rect);
+      if (kind == Kind::FillRect) SDL_RenderFillRectsF(r, m_rects.data(), (int)m_rects.size());
+      else                        SDL_RenderDrawRectsF(r, m_rects.data(), (int)m_rects.size());
+      m_stats.flushes++;
+      break;
+    }
+
+    case Kind::Line:
+      for (size_t i = begin; i < end; i++) {
+        const SDL_FRect& p = m_cmds[i].rect;
+        SDL_RenderDrawLineF(r, p.x, p.y, p.w, p.h);
+        m_stats.flushes++;
+      }
+      break;
+
+    case Kind::Polyline:
+      for (size_t i = begin; i < end; i++) {
+        const Command& c = m_cmds[i];
+        SDL_RenderDrawLinesF(r, &m_points[c.first], (int)c.count);
+        m_stats.flushes++;
+      }
+      break;
+
+    case Kind::Geometry: {
+      // Concatenate into one indexed batch
+      m_batchVerts.clear();
+      m_batchIndices.clear();
+      for (size_t i = begin; i < end; i++) {
+        const Command& c = m_cmds[i];
+        const int base = (int)m_batchVerts.size();
+        m_batchVerts.insert(m_batchVerts.end(), &m_verts[c.first], &m_verts[c.first] + c.count);
+        for (uint32_t k = 0; k < c.indexCount; k++) {
+          m_batchIndices.push_back(base + m_indices[c.indexFirst + k]);
+        }
+      }
+      SDL_RenderGeometry(r, m_cmds[begin].tex,
+        m_batchVerts.data(), (int)m_batchVerts.size(),
+        m_batchIndices.data(), (int)m_batchIndices.size());
+      m_stats.flushes++;
+      break;
+    }
+
+    case Kind::Texture:
+      for (size_t i = begin; i < end; i++) {
+        const Command& c = m_cmds[i];
+        SDL_RenderCopyF(r, c.tex, c.hasSrc ? &c.src : nullptr, &c.rect);
+        m_stats.flushes++;
+      }
+      break;
+  }
+}
+
+bool RenderQueue::bindState(const Command& c, BoundState& s) {
+  if (c.kind != Kind::Geometry && c.kind != Kind::Texture) {
+    const uint64_t want = colorMaterial(c.color);
+    if (s.haveColor && want == s.color) return false;
+    s.haveColor = true;
+    s.color = want;
+  } else {
+    const uint64_t want = c.key & ((1ull << 52) - 1); // the texture
+    if (s.haveBinding && want == s.binding) return false;
+    s.haveBinding = true;
+    s.binding = want;
+  }
+  m_stats.stateChanges++;
+  return true;
+}
+
+void RenderQueue::sortCommands() {
+  if (m_sorted) return;
+  m_sorted = true;
+  std::sort(m_cmds.begin(), m_cmds.end(), [](const Command& a, const Command& b) {
+    return (a.key != b.key) ? (a.key < b.key) : (a.seq < b.seq);
+  });
+}
+
+void RenderQueue::layerRange(uint8_t first, uint8_t last, size_t& begin, size_t& end) const {
+  // Commands are sorted, and the layer is the top byte of the key
+  auto byLayer = [](const Command& c, uint64_t key) { return c.key < key; };
+  begin = std::lower_bound(m_cmds.begin(), m_cmds.end(), (uint64_t)first << 56, byLayer) - m_cmds.begin();
+  end = (last == 255) ? m_cmds.size()
+      : std::lower_bound(m_cmds.begin(), m_cmds.end(), (uint64_t)(last + 1) << 56, byLayer) - m_cmds.begin();
+}
+
+void RenderQueue::flush(SDL_Renderer* r, const SDL_Rect* clip, uint8_t firstLayer, uint8_t lastLayer) {
+  m_stats.commands = (int)m_cmds.size();
+  if (!r) return;
+
+  m_hasClip = (clip != nullptr);
+  if (m_hasClip) m_clip = *clip;
+  SDL_RenderSetClipRect(r, clip);
+
+  sortCommands();
+  size_t first = 0, last = 0;
+  layerRange(firstLayer, lastLayer, first, last);
+
+  // Runs share kind + material; the layer may differ (merging across layers
+  // keeps order because batches draw in sequence).
+  const uint64_t stateMask = (1ull << 56) - 1;
+
+  BoundState bound;
+
+  size_t i = first;
+  while (i < last) {
+    const uint64_t state = m_cmds[i].key & stateMask;
+    size_t j = i + 1;
+    while (j < last && (m_cmds[j].key & stateMask) == state) j++;
+
+    const Command& c = m_cmds[i];
+    if (bindState(c, bound) && c.kind != Kind::Geometry && c.kind != Kind::Texture) {
+      SDL_SetRenderDrawColor(r, c.color.r, c.color.g, c.color.b, c.color.a);
+    }
+
+    submitRun(r, i, j);
+    i = j;
+  }
+
+  if (m_hasClip) SDL_RenderSetClipRect(r, nullptr);
+}
+
+void RenderQueue::flush(SoftRaster& soft, uint8_t firstLayer, uint8_t lastLayer) {
+  m_stats.commands = (int)m_cmds.size();
+
+  sortCommands();
+  size_t first = 0, last = 0;
+  layerRange(firstLayer, lastLayer, first, last);
+
+  // The rasterizer bins per tile, so batching by state buys nothing there:
+  // replay in painter's order and count primitives as "flushes".
+  // State changes are counted as on the SDL path, so the two compare.
+  const int before = soft.primitives();
+  BoundState bound;
+  for (size_t i = first; i < last; i++) {
+    const Command& c = m_cmds[i];
+    bindState(c, bound);
+    switch (c.kind) {
+      case Kind::Clear:
+        soft.clear(c.color);
+        break;
+
+      case Kind::FillRect:
+        soft.fillRect(c.rect, c.color);
+        break;
+
+      case Kind::DrawRect: {
+        // 1 px outline inside the rect, as SDL_RenderDrawRectF draws it
+        const float x = std::round(c.rect.x), y = std::round(c.rect.y);
+        const float w = std::round(c.rect.w), h = std::round(c.rect.h);
+        if (w <= 0.f || h <= 0.f) break;
+        soft.fillRect(SDL_FRect{ x, y, w, 1.f }, c.color);
+        soft.fillRect(SDL_FRect{ x, y + h - 1.f, w, 1.f }, c.color);
+        soft.fillRect(SDL_FRect{ x, y + 1.f, 1.f, h - 2.f }, c.color);
+        soft.fillRect(SDL_FRect{ x + w - 1.f, y + 1.f, 1.f, h - 2.f }, c.color);
+        break;
+      }
+
+      case Kind::Line:
+        soft.line(c.rect.x, c.rect.y, c.rect.w, c.rect.h, c.color);
+        break;
+
+      case Kind::Polyline:
+        for (uint32_t k = 1; k < c.count; k++) {
+          const SDL_FPoint& a = m_points[c.first + k - 1];
+          const SDL_FPoint& b = m_points[c.first + k];
+          soft.line(a.x, a.y, b.x, b.y, c.color);
+        }
+        break;
+
+      case Kind::Geometry:
+        soft.geometry(c.tex, m_verts.data() + c.first, (int)c.count,
+                      m_indices.data() + c.indexFirst, (int)c.indexCount);
+        break;
+
+      case Kind::Texture:
+        soft.texture(c.tex, c.hasSrc ? &c.src : nullptr, c.rect);
+        break;
+    }
+  }
+
+  m_stats.flushes += soft.primitives() - before;
+}
@@ -0,0 +1,120 @@
+// src/RenderQueue.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <vector>
+
+class SoftRaster;
+
+// Per-frame render command buffer.
+//
+// Scenes record quads, lines, geometry and textures with a layer instead
+// of calling SDL directly. flush() sorts by layer, then by render state
+// (kind + color / texture), and submits each run of identical
+// state with as few SDL calls as possible (e.g. one SDL_RenderFillRectsF for
+// every same-colored quad).
+//
+// Painter's order is only guaranteed BETWEEN layers: commands inside one
+// layer must not depend on each other's order. Put things that overlap
+// (a car and its window) on successive layers.
+class RenderQueue {
+public:
+  // Base layers; scenes add small offsets (LayerActors + 1, ...) for detail.
+  enum Layer : uint8_t {
+    LayerBackground = 0,
+    LayerWorld      = 20,
+    LayerActors     = 40,
+    LayerHud        = 60,
+    LayerOverlay    = 80,
+  };
+
+  struct Stats {
+    int commands = 0;      // recorded this frame
+    int stateChanges = 0;  // draw color / texture switches
+    int flushes = 0;       // SDL draw calls issued
+  };
+
+  void begin();
+  void clear(SDL_Color c); // clears the target before anything else is drawn
+
+  void fillRect(uint8_t layer, const SDL_FRect& rect, SDL_Color c);
+  void drawRect(uint8_t layer, const SDL_FRect& rect, SDL_Color c);
+  void line(uint8_t layer, float x1, float y1, float x2, float y2, SDL_Color c);
+  void polyline(uint8_t layer, const SDL_FPoint* points, int count, SDL_Color c);
+
+  // Indexed triangles (copied). Same-texture geometry is merged on flush.
+  void geometry(uint8_t layer, SDL_Texture* tex,
+                const SDL_Vertex* verts, int vertCount,
+                const int* indices, int indexCount);
+
+  void texture(uint8_t layer, SDL_Texture* tex, const SDL_Rect* src, const SDL_FRect& dst);
+
+  // With a clip rect only that area is touched; Clear fills the clip
+  // instead of the whole target (SDL_RenderClear ignores clipping).
+  // A layer range submits part of the frame (e.g. the world into a scaled
+  // target, then the HUD at native size); stats add up until begin().
+  void flush(SDL_Renderer* r, const SDL_Rect* clip = nullptr,
+             uint8_t firstLayer = 0, uint8_t lastLayer = 255);
+
+  // Replay the frame into the CPU rasterizer instead (after soft.begin())
+  void flush(SoftRaster& soft, uint8_t firstLayer = 0, uint8_t lastLayer = 255);
+
+  const Stats& stats() const { return m_stats; }
+
+private:
+  enum class Kind : uint8_t { Clear, FillRect, DrawRect, Line, Polyline, Geometry, Texture };
+
+  struct Command {
+    uint64_t     key = 0;      // layer | kind | material, see makeKey()
+    uint32_t     seq = 0;      // submission order (tie-break)
+    Kind         kind = Kind::FillRect;
+    SDL_Color    color{};
+    SDL_FRect    rect{};
+    SDL_Rect     src{};
+    bool         hasSrc = false;
+    SDL_Texture* tex = nullptr;
+    uint32_t     first = 0;    // into points / verts
+    uint32_t     count = 0;
+    uint32_t     indexFirst = 0;
+    uint32_t     indexCount = 0;
+  };
+
+  // Draw color / texture last bound by a flush
+  struct BoundState {
+    bool     haveColor = false;
+    uint64_t color = 0;
+    bool     haveBinding = false;
+    uint64_t binding = 0;
+  };
+
+  static uint64_t makeKey(uint8_t layer, Kind kind, uint64_t material);
+  static uint64_t colorMaterial(SDL_Color c);
+  static uint64_t pointerMaterial(const void* p);
+
+  Command& push(uint8_t layer, Kind kind, uint64_t material);
+
+  // Binds c's color or texture in `s`; true (and counted) if it changed
+  bool bindState(const Command& c, BoundState& s);
+
+  void sortCommands();
+  void layerRange(uint8_t first, uint8_t last, size_t& begin, size_t& end) const;
+
+  // Emit commands [begin, end) which share kind + material
+  void submitRun(SDL_Renderer* r, size_t begin, size_t end);
+
+  std::vector<Command>    m_cmds;
+  std::vector<SDL_FPoint> m_points;
+  std::vector<SDL_Vertex> m_verts;
+  std::vector<int>        m_indices;
+
+  // flush() scratch (kept to avoid per-frame allocations)
+  std::vector<SDL_FRect>  m_rects;
+  std::vector<SDL_Vertex> m_batchVerts;
+  std::vector<int>        m_batchIndices;
+  SDL_Rect m_clip{};
+  bool     m_hasClip = false;
+  bool     m_sorted = false;
+
+  Stats m_stats{};
+};
@@ -0,0 +1,117 @@
+// src/RoadTrack.cpp
+#include "RoadTrack.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// splitmix64: cheap, well-mixed hash for per-knot randomness
+uint64_t mix(uint64_t x) {
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+// Uniform float in [-1, 1]
+float unitNoise(uint32_t seed, int64_t k, uint64_t salt) {
+  uint64_t h = mix((uint64_t)seed * 0x100000001B3ull ^ (uint64_t)k ^ (salt << 56));
+  return (float)((h >> 40) * (1.0 / 8388608.0)) - 1.f; // 24 bits -> [0,2) - 1
+}
+
+float catmullRom(float p0, float p1, float p2, float p3, float t) {
+  float t2 = t * t;
+  float t3 = t2 * t;
+  return 0.5f * ((2.f * p1) +
+                 (-p0 + p2) * t +
+                 (2.f * p0 - 5.f * p1 + 4.f * p2 - p3) * t2 +
+                 (-p0 + 3.f * p1 - 3.f * p2 + p3) * t3);
+}
+
+} // namespace
+
+void RoadTrack::reset(const Params& p) {
+  m_params = p;
+  for (auto& s : m_cache) s.index = INT64_MIN;
+}
+
+int64_t RoadTrack::segmentIndex(double worldY) {
+  return (int64_t)std::floor(worldY / SEGMENT_LENGTH);
+}
+
+int RoadTrack::slotFor(int64_t index) {
+  int64_t m = index % CACHE_SEGMENTS;
+  return (int)(m < 0 ? m + CACHE_SEGMENTS : m);
+}
+
+float RoadTrack::knotOffset(int64_t k) const {
+  // Straight start: the first screenful is always centered
+  if (k <= 1) return 0.f;
+  return m_params.maxOffset * unitNoise(m_params.seed, k, 1);
+}
+
+float RoadTrack::knotWidth(int64_t k) const {
+  if (k <= 1) return m_params.baseWidth;
+  float u = 0.5f + 0.5f * unitNoise(m_params.seed, k, 2); // 0..1
+  return m_params.minWidth + (m_params.baseWidth - m_params.minWidth) * u;
+}
+
+void RoadTrack::evaluate(int64_t index, float t, float& center, float& width) const {
+  center = catmullRom(knotOffset(index - 1), knotOffset(index),
+                      knotOffset(index + 1), knotOffset(index + 2), t);
+  width = catmullRom(knotWidth(index - 1), knotWidth(index),
+                     knotWidth(index + 1), knotWidth(index + 2), t);
+
+  // Catmull-Rom can overshoot the knots slightly
+  width = std::max(m_params.minWidth, std::min(width, m_params.baseWidth));
+}
+
+void RoadTrack::bake(Segment& s, int64_t index) const {
+  s.index = index;
+  for (int i = 0; i <= SAMPLES; i++) {
+    evaluate(index, (float)i / SAMPLES, s.center[i], s.width[i]);
+  }
+}
+
+void RoadTrack::prepare(double from, double to) {
+  const int64_t first = segmentIndex(from);
+  const int64_t last = std::min(segmentIndex(to), first + CACHE_SEGMENTS - 1);
+
+  // Slots are index % CACHE_SEGMENTS, so baking a new segment ahead
+  // naturally evicts the one CACHE_SEGMENTS behind it.
+  for (int64_t k = first; k <= last; k++) {
+    Segment& s = m_cache[slotFor(k)];
+    if (s.index != k) bake(s, k);
+  }
+}
+
+void RoadTrack::sample(double worldY, float& center, float& width) const {
+  const int64_t index = segmentIndex(worldY);
+  const float t = (float)((worldY - (double)index * SEGMENT_LENGTH) / SEGMENT_LENGTH);
+
+  const Segment& s = m_cache[slotFor(index)];
+  if (s.index != index) {
+    // Not prepared (e.g. before the first update): evaluate directly
+    evaluate(index, t, center, width);
+    return;
+  }
+
+  float f = t * SAMPLES;
+  int i = std::min((int)f, SAMPLES - 1);
+  float a = f - (float)i;
+  center = s.center[i] + (s.center[i + 1] - s.center[i]) * a;
+  width = s.width[i] + (s.width[i + 1] - s.width[i]) * a;
+}
+
+float RoadTrack::centerOffset(double worldY) const {
+  float c = 0.f, w = 0.f;
+  sample(worldY, c, w);
+  return c;
+}
+
+float RoadTrack::width(double worldY) const {
+  float c = 0.f, w = 0.f;
+  sample(worldY, c, w);
+  return w;
+}
@@ -0,0 +1,56 @@
+// src/RoadTrack.h
+#pragma once
+
+#include <cstdint>
+
+// Endless procedural road: center offset + width along world distance.
+//
+// The road is a Catmull-Rom spline through pseudo-random knots spaced
+// SEGMENT_LENGTH apart (knots are a pure function of seed + index, so any
+// segment can be rebuilt at any time). Each segment bakes a small lookup
+// table; segments live in a fixed ring of CACHE_SEGMENTS slots that is
+// filled ahead of the camera by prepare() and overwritten behind it, so
+// memory stays constant over endless runs and queries are O(1).
+class RoadTrack {
+public:
+  static constexpr int SEGMENT_LENGTH = 640; // world px between knots
+  static constexpr int SAMPLES        = 64;  // LUT steps per segment (10 px)
+  static constexpr int CACHE_SEGMENTS = 8;   // 5120 px cached, > tallest screen
+
+  struct Params {
+    float    baseWidth = 560.f; // widest road
+    float    minWidth  = 500.f; // narrowest road
+    float    maxOffset = 0.f;   // max center drift either way (px)
+    uint32_t seed      = 0;
+  };
+
+  void reset(const Params& p);
+
+  // Ensure segments covering world range [from, to] are baked.
+  void prepare(double from, double to);
+
+  // Center offset from the middle of the screen, and road width, at worldY.
+  float centerOffset(double worldY) const;
+  float width(double worldY) const;
+
+private:
+  struct Segment {
+    int64_t index = INT64_MIN;
+    float   center[SAMPLES + 1];
+    float   width[SAMPLES + 1];
+  };
+
+  static int64_t segmentIndex(double worldY);
+  static int     slotFor(int64_t index);
+
+  float knotOffset(int64_t k) const;
+  float knotWidth(int64_t k) const;
+  void  evaluate(int64_t index, float t, float& center, float& width) const;
+  void  bake(Segment& s, int64_t index) const;
+
+  // Shared body of centerOffset()/width(): LUT when cached, spline otherwise.
+  void sample(double worldY, float& center, float& width) const;
+
+  Params  m_params{};
+  Segment m_cache[CACHE_SEGMENTS];
+};
@@ -1,6 +1,9 @@
 // src/Scene.h
 #pragma once
 #include <SDL2/SDL.h>
+#include <vector>
+
+#include "RenderQueue.h"
 
 class Scene {
 public:
@@ -12,6 +15,21 @@ public:
   // Per-frame update
   virtual void update(float dt) = 0;
 
-  // Draw scene content. Game() will call SDL_RenderPresent().
-  virtual void render(SDL_Renderer* r) = 0;
+  // Record scene content. Game() flushes the queue and calls SDL_RenderPresent().
+  virtual void render(RenderQueue& q) = 0;
+
+  // Dirty-region tracking (opt-in). Return false to be redrawn every frame.
+  // Return true and append the screen areas that changed since the last
+  // render(); leaving `rects` empty means the previous frame is still valid
+  // and Game skips rendering and presenting. Game forces a full redraw on
+  // its own after scene switches, resizes and renderer rebuilds.
+  virtual bool dirtyRegions(std::vector<SDL_Rect>& rects) { (void)rects; return false; }
+
+  // Milliseconds Game may block waiting for input before the scene needs its
+  // next frame: 0 animates continuously (vsync-paced), NO_DEADLINE sleeps
+  // until an event arrives.
+  static constexpr Uint32 NO_DEADLINE = 0xFFFFFFFFu;
+  // One 60 Hz frame: the shortest wait that still counts as idle
+  static constexpr Uint32 IDLE_FRAME_MS = 16;
+  virtual Uint32 idleTimeout() const { return 0; }
 };
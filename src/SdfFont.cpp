@@ -0,0 +1,607 @@
+// src/SdfFont.cpp
+#include "SdfFont.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+
+// Baked sizes kept alive; a UI uses a handful, resolution changes add more
+static constexpr size_t MAX_BAKED = 8;
+// Cached layouts kept alive (strings that change every frame churn through)
+static constexpr size_t MAX_LAYOUTS = 256;
+
+static constexpr int NEWLINE = -1;
+
+static constexpr float FAR = 1e20f;
+
+// 1D squared Euclidean distance transform of sampled function f
+// (Felzenszwalb & Huttenlocher); v, z are scratch of n and n + 1.
+static void distance1d(const float* f, int n, float* d, int* v, float* z) {
+  auto meet = [&](int q, int p) {
+    return ((f[q] + (float)q * q) - (f[p] + (float)p * p)) / (2.f * (q - p));
+  };
+
+  int k = 0;
+  v[0] = 0;
+  z[0] = -FAR;
+  z[1] = FAR;
+  for (int q = 1; q < n; q++) {
+    float s = meet(q, v[k]);
+    while (s <= z[k]) {
+      k--;
+      s = meet(q, v[k]);
+    }
+    k++;
+    v[k] = q;
+    z[k] = s;
+    z[k + 1] = FAR;
+  }
+
+  k = 0;
+  for (int q = 0; q < n; q++) {
+    while (z[k + 1] < q) k++;
+    const float dq = (float)(q - v[k]);
+    d[q] = dq * dq + f[v[k]];
+  }
+}
+
+// In-place 2D transform (columns, then rows) of a w x h grid
+static void distance2d(std::vector<float>& grid, int w, int h) {
+  const int n = std::max(w, h);
+  std::vector<float> f((size_t)n), d((size_t)n), z((size_t)n + 1);
+  std::vector<int> v((size_t)n);
+
+  for (int x = 0; x < w; x++) {
+    for (int y = 0; y < h; y++) f[y] = grid[(size_t)y * w + x];
+    distance1d(f.data(), h, d.data(), v.data(), z.data());
+    for (int y = 0; y < h; y++) grid[(size_t)y * w + x] = d[y];
+  }
+  for (int y = 0; y < h; y++) {
+    float* row = grid.data() + (size_t)y * w;
+    std::copy(row, row + w, f.begin());
+    distance1d(f.data(), w, d.data(), v.data(), z.data());
+    std::copy(d.begin(), d.begin() + w, row);
+  }
+}
+
+SdfFont::~SdfFont() {
+  if (!m_textures) return;
+  for (auto& b : m_baked) m_textures->remove(b.second.tex);
+}
+
+bool SdfFont::build(TTF_Font* font) {
+  if (!font) return false;
+
+  const int lineH = TTF_FontHeight(font);
+  const SDL_Color white { 255, 255, 255, 255 };
+
+  // Rasterize every glyph and turn its coverage into a signed distance
+  std::vector<Glyph> glyphs((size_t)(LAST - FIRST + 1));
+  std::vector<std::vector<uint8_t>> fields(glyphs.size());
+  std::vector<float> outside, inside, coverage;
+
+  for (int c = FIRST; c <= LAST; c++) {
+    Glyph& g = glyphs[(size_t)(c - FIRST)];
+    int minx = 0, maxx = 0, miny = 0, maxy = 0, advance = 0;
+    if (TTF_GlyphMetrics32(font, (Uint32)c, &minx, &maxx, &miny, &maxy, &advance) == 0) {
+      g.advance = (float)advance;
+      g.inkRight = (float)maxx;
+    }
+
+    SDL_Surface* img = TTF_RenderGlyph32_Blended(font, (Uint32)c, white);
+    SDL_Surface* argb = img ? SDL_ConvertSurfaceFormat(img, SDL_PIXELFORMAT_ARGB8888, 0) : nullptr;
+    if (img) SDL_FreeSurface(img);
+
+    g.imgW = argb ? argb->w : 0;
+    const int w = g.imgW + 2 * SPREAD;
+    const int h = lineH + 2 * SPREAD;
+    g.cell.w = w;
+    g.cell.h = h;
+
+    // Binary transforms to the nearest pixel center on the other side; the
+    // outline lies about half a pixel short of that. Anti-aliased edge
+    // pixels know their offset better from coverage (0.5 - coverage).
+    outside.assign((size_t)w * h, FAR);
+    inside.assign((size_t)w * h, 0.f);
+    coverage.assign((size_t)w * h, 0.f);
+    if (argb) {
+      SDL_LockSurface(argb);
+      const int rows = std::min(argb->h, lineH);
+      for (int y = 0; y < rows; y++) {
+        const uint32_t* px = (const uint32_t*)((const uint8_t*)argb->pixels + (size_t)y * argb->pitch);
+        for (int x = 0; x < argb->w; x++) {
+          const float a = (float)(px[x] >> 24) / 255.f;
+          const size_t i = (size_t)(y + SPREAD) * w + (x + SPREAD);
+          coverage[i] = a;
+          if (a >= 0.5f) {
+            outside[i] = 0.f;
+            inside[i] = FAR;
+          }
+        }
+      }
+      SDL_UnlockSurface(argb);
+      SDL_FreeSurface(argb);
+    }
+    distance2d(outside, w, h);
+    distance2d(inside, w, h);
+
+    std::vector<uint8_t>& field = fields[(size_t)(c - FIRST)];
+    field.resize((size_t)w * h);
+    for (size_t i = 0; i < field.size(); i++) {
+      const float a = coverage[i];
+      float dist; // > 0 outside
+      if (a > 0.f && a < 1.f) dist = 0.5f - a;
+      else if (a >= 0.5f)     dist = 0.5f - std::sqrt(inside[i]);
+      else                    dist = std::sqrt(outside[i]) - 0.5f;
+      const float v = 128.f - dist * (127.f / SPREAD);
+      field[i] = (uint8_t)std::min(255.f, std::max(0.f, v + 0.5f));
+    }
+  }
+
+  // Shelf-pack the cells (all one height) into a single field atlas
+  const int atlasW = 512;
+  int x = 0, y = 0;
+  for (Glyph& g : glyphs) {
+    if (x + g.cell.w > atlasW) {
+      x = 0;
+      y += g.cell.h;
+    }
+    g.cell.x = x;
+    g.cell.y = y;
+    x += g.cell.w;
+  }
+
+  m_fieldW = atlasW;
+  m_fieldH = y + lineH + 2 * SPREAD;
+  m_field.assign((size_t)m_fieldW * m_fieldH, 0);
+  for (size_t i = 0; i < glyphs.size(); i++) {
+    const SDL_Rect& r = glyphs[i].cell;
+    for (int row = 0; row < r.h; row++) {
+      std::copy(fields[i].begin() + (size_t)row * r.w, fields[i].begin() + (size_t)(row + 1) * r.w,
+                m_field.begin() + (size_t)(r.y + row) * m_fieldW + r.x);
+    }
+  }
+
+  // Kerning for every printable pair, so layout never asks SDL_ttf
+  m_kerning.assign((size_t)COUNT * COUNT, 0);
+#if SDL_TTF_VERSION_ATLEAST(2, 0, 18)
+  for (int a = 0; a < COUNT; a++) {
+    for (int b = 0; b < COUNT; b++) {
+      const int k = TTF_GetFontKerningSizeGlyphs32(font, (Uint32)(FIRST + a), (Uint32)(FIRST + b));
+      m_kerning[(size_t)a * COUNT + b] = (int8_t)std::min(127, std::max(-128, k));
+    }
+  }
+#endif
+
+  m_glyphs = std::move(glyphs);
+  m_lineH = lineH;
+  return true;
+}
+
+void SdfFont::attach(TextureRegistry& textures) {
+  if (m_lineH > 0) m_textures = &textures;
+}
+
+int SdfFont::glyphIndex(uint32_t codepoint) {
+  if (codepoint < (uint32_t)FIRST || codepoint > (uint32_t)LAST) codepoint = '?';
+  return (int)codepoint - FIRST;
+}
+
+// Next code point of a UTF-8 string; malformed bytes decode as U+FFFD
+static uint32_t nextCodepoint(const char*& p) {
+  const uint8_t c = (uint8_t)*p++;
+  if (c < 0x80) return c;
+
+  int extra = 0;
+  uint32_t cp = 0;
+  if ((c & 0xE0) == 0xC0)      { extra = 1; cp = c & 0x1F; }
+  else if ((c & 0xF0) == 0xE0) { extra = 2; cp = c & 0x0F; }
+  else if ((c & 0xF8) == 0xF0) { extra = 3; cp = c & 0x07; }
+  else return 0xFFFD;
+
+  for (int i = 0; i < extra; i++) {
+    if (((uint8_t)*p & 0xC0) != 0x80) return 0xFFFD; // don't step over the NUL
+    cp = (cp << 6) | ((uint8_t)*p++ & 0x3F);
+  }
+  return cp;
+}
+
+static uint64_t hashLayout(const char* text, const TextStyle& st) {
+  uint64_t h = 1469598103934665603ull; // FNV-1a
+  for (const char* p = text; *p; p++) h = (h ^ (uint8_t)*p) * 1099511628211ull;
+  const float f[2] = { st.px, st.width };
+  const uint8_t* b = (const uint8_t*)f;
+  for (size_t i = 0; i < sizeof(f); i++) h = (h ^ b[i]) * 1099511628211ull;
+  const uint32_t flags = (uint32_t)st.align | (st.wrap << 2) | (st.ellipsis << 3) | ((uint32_t)st.maxLines << 4);
+  return (h ^ flags) * 1099511628211ull;
+}
+
+float SdfFont::measure(const char* text, float px) {
+  TextStyle style;
+  style.px = px;
+  return layout(text, style).width;
+}
+
+const TextLayout& SdfFont::layout(const char* text, const TextStyle& style) {
+  static const TextLayout empty;
+  if (!ready() || !text || m_lineH <= 0) return empty;
+
+  const uint64_t key = hashLayout(text, style);
+  CachedLayout& c = m_layouts[key];
+  if (!c.built || c.text != text || !(c.style == style)) {
+    c.text = text;
+    c.style = style;
+    buildLayout(text, style, c.layout);
+    c.built = true;
+  }
+  c.used = true;
+  return c.layout;
+}
+
+void SdfFont::buildLayout(const char* text, const TextStyle& st, TextLayout& out) {
+  out = TextLayout{};
+  out.px = st.px;
+  const float s = st.px / (float)m_lineH;
+  const bool bounded = st.width > 0.f;
+
+  m_codepoints.clear();
+  for (const char* p = text; *p;) {
+    const uint32_t cp = nextCodepoint(p);
+    m_codepoints.push_back(cp == '\n' ? NEWLINE : glyphIndex(cp));
+  }
+  const size_t n = m_codepoints.size();
+  const int space = ' ' - FIRST;
+  const int dot = '.' - FIRST;
+
+  // Pen after a glyph, and where its ink ends (italic overhang etc.)
+  auto step = [&](int prev, int g, float pen, float& right) {
+    const float k = (prev >= 0) ? kerning(prev, g) * s : 0.f;
+    right = pen + k + std::max(m_glyphs[(size_t)g].advance, m_glyphs[(size_t)g].inkRight) * s;
+    return pen + k + m_glyphs[(size_t)g].advance * s;
+  };
+
+  size_t start = 0;
+  for (;;) {
+    // Greedy: take glyphs until the box is full, then back up to a space
+    size_t j = start, lastSpace = SIZE_MAX;
+    float pen = 0.f, right = 0.f;
+    int prev = -1;
+    for (; j < n && m_codepoints[j] != NEWLINE; j++) {
+      const int g = m_codepoints[j];
+      float r = 0.f;
+      const float next = step(prev, g, pen, r);
+      if (st.wrap && bounded && j > start && r > st.width) break;
+      if (g == space) lastSpace = j;
+      pen = next;
+      prev = g;
+    }
+
+    size_t end = j, resume = j;
+    const bool wrapped = (j < n && m_codepoints[j] != NEWLINE);
+    if (wrapped && lastSpace != SIZE_MAX && lastSpace > start) {
+      end = lastSpace;
+      resume = lastSpace + 1;
+    } else if (!wrapped && j < n) {
+      resume = j + 1; // past the '\n'
+    }
+    if (wrapped) {
+      // The break swallows the spaces around it
+      while (end > start && m_codepoints[end - 1] == space) end--;
+      while (resume < n && m_codepoints[resume] == space) resume++;
+    }
+
+    const bool last = (resume >= n && !(j < n && m_codepoints[j] == NEWLINE)) ||
+                      (st.maxLines > 0 && out.lines + 1 >= st.maxLines);
+    const bool cut = last && resume < n;
+
+    // Place the line
+    const size_t first = out.glyphs.size();
+    const float y = out.lines * st.px;
+    pen = 0.f;
+    right = 0.f;
+    prev = -1;
+    for (size_t i = start; i < end; i++) {
+      const int g = m_codepoints[i];
+      TextLayout::Glyph lg;
+      lg.index = (uint16_t)g;
+      lg.x = pen + ((prev >= 0) ? kerning(prev, g) * s : 0.f);
+      lg.y = y;
+      out.glyphs.push_back(lg);
+      pen = step(prev, g, pen, right);
+      prev = g;
+    }
+
+    // Ellipsis: drop glyphs until "..." fits after them
+    if (st.ellipsis && bounded && (cut || right > st.width)) {
+      float dots = 0.f, dotsRight = 0.f;
+      int dprev = -1;
+      for (int d = 0; d < 3; d++) {
+        dots = step(dprev, dot, dots, dotsRight);
+        dprev = dot;
+      }
+      while (out.glyphs.size() > first) {
+        const TextLayout::Glyph& g = out.glyphs.back();
+        pen = g.x + m_glyphs[g.index].advance * s;
+        if (pen + dotsRight <= st.width) break;
+        out.glyphs.pop_back();
+      }
+      if (out.glyphs.size() == first) pen = 0.f;
+      for (int d = 0; d < 3; d++) {
+        TextLayout::Glyph lg;
+        lg.index = (uint16_t)dot;
+        lg.x = pen + (dots / 3.f) * d;
+        lg.y = y;
+        out.glyphs.push_back(lg);
+      }
+      right = pen + dotsRight;
+      pen += dots;
+      out.truncated = true;
+    }
+    if (cut) out.truncated = true;
+
+    // Align inside the box
+    float shift = 0.f;
+    if (st.align == TextAlign::Center) shift = (st.width - right) * 0.5f;
+    else if (st.align == TextAlign::Right) shift = st.width - right;
+    if (shift != 0.f) {
+      for (size_t i = first; i < out.glyphs.size(); i++) out.glyphs[i].x += shift;
+    }
+
+    out.width = std::max(out.width, right);
+    out.advance = pen;
+    out.lines++;
+    if (last) break;
+    start = resume;
+  }
+  out.height = out.lines * st.px;
+}
+
+void SdfFont::layoutBaked(Baked& b) const {
+  b.scale = (float)b.px / (float)m_lineH;
+  b.pad = std::max(1, (int)std::ceil(SPREAD * b.scale));
+
+  const int cellH = b.px + 2 * b.pad;
+  b.w = (b.px > 48) ? 1024 : 512;
+  b.cells.resize(m_glyphs.size());
+
+  int x = 0, y = 0;
+  for (size_t i = 0; i < m_glyphs.size(); i++) {
+    const int cellW = (int)std::ceil(m_glyphs[i].imgW * b.scale) + 2 * b.pad;
+    if (x + cellW > b.w) {
+      x = 0;
+      y += cellH;
+    }
+    b.cells[i] = SDL_Rect{ x, y, cellW, cellH };
+    x += cellW;
+  }
+  b.h = y + cellH;
+}
+
+float SdfFont::sample(float x, float y) const {
+  x = std::min(std::max(x, 0.f), (float)(m_fieldW - 1));
+  y = std::min(std::max(y, 0.f), (float)(m_fieldH - 1));
+  const int x0 = (int)x, y0 = (int)y;
+  const int x1 = std::min(x0 + 1, m_fieldW - 1), y1 = std::min(y0 + 1, m_fieldH - 1);
+  const float fx = x - x0, fy = y - y0;
+
+  const uint8_t* row0 = m_field.data() + (size_t)y0 * m_fieldW;
+  const uint8_t* row1 = m_field.data() + (size_t)y1 * m_fieldW;
+  const float top = row0[x0] + (row0[x1] - row0[x0]) * fx;
+  const float bot = row1[x0] + (row1[x1] - row1[x0]) * fx;
+  return top + (bot - top) * fy;
+}
+
+// Coverage of pixel (ox, oy) of a glyph cell rendered at `scale` with
+// `pad` pixels of padding; false where the pixel maps outside the field
+bool SdfFont::coverage(const SDL_Rect& src, float scale, int pad, int ox, int oy,
+                       float& a) const {
+  // Output pixel center -> source pixel center, both relative to the
+  // unpadded glyph origin
+  const float inv = 1.f / scale;
+  const float sy = src.y + SPREAD + (oy - pad + 0.5f) * inv - 0.5f;
+  if (sy < src.y - 0.5f || sy > src.y + src.h - 0.5f) return false;
+  const float sx = src.x + SPREAD + (ox - pad + 0.5f) * inv - 0.5f;
+  if (sx < src.x - 0.5f || sx > src.x + src.w - 0.5f) return false;
+
+  // Distance in output pixels; a one-pixel ramp anti-aliases the edge
+  const float dist = (128.f - sample(sx, sy)) * (SPREAD / 127.f) * scale;
+  a = std::min(1.f, std::max(0.f, 0.5f - dist));
+  return true;
+}
+
+void SdfFont::bake(const Baked& b, uint32_t* out) const {
+  for (size_t i = 0; i < m_glyphs.size(); i++) {
+    const SDL_Rect& dst = b.cells[i];
+    for (int oy = 0; oy < dst.h; oy++) {
+      uint32_t* row = out + (size_t)(dst.y + oy) * b.w + dst.x;
+      for (int ox = 0; ox < dst.w; ox++) {
+        float a = 0.f;
+        if (!coverage(m_glyphs[i].cell, b.scale, b.pad, ox, oy, a)) continue;
+        row[ox] = ((uint32_t)(a * 255.f + 0.5f) << 24) | 0x00FFFFFFu;
+      }
+    }
+  }
+}
+
+SdfFont::Baked* SdfFont::baked(int px) {
+  px = std::max(px, 4);
+
+  auto it = m_baked.find(px);
+  if (it == m_baked.end()) {
+    Baked& b = m_baked[px];
+    b.px = px;
+    layoutBaked(b);
+
+    // The registry regenerates from the field whenever it re-uploads
+    const Baked* bp = &b;
+    b.tex = m_textures->add(b.w, b.h, [this, bp](uint32_t* argb, int, int) {
+      bake(*bp, argb);
+    });
+    it = m_baked.find(px);
+  }
+  it->second.used = true;
+  return &it->second;
+}
+
+void SdfFont::addQuad(const Baked& b, int index, float x, float y, SDL_Color c,
+                      std::vector<SDL_Vertex>& verts, std::vector<int>& indices) const {
+  if (m_glyphs[(size_t)index].imgW <= 0) return;
+
+  // Whole-pixel placement keeps the baked texels 1:1 with the screen
+  const SDL_Rect& cell = b.cells[(size_t)index];
+  const float invW = 1.f / b.w, invH = 1.f / b.h;
+  const float left = std::round(x) - b.pad;
+  const float top = std::round(y) - b.pad;
+  const float u0 = cell.x * invW, v0 = cell.y * invH;
+  const float u1 = (cell.x + cell.w) * invW, v1 = (cell.y + cell.h) * invH;
+  const int base = (int)verts.size();
+
+  verts.push_back(SDL_Vertex{ { left,          top },          c, { u0, v0 } });
+  verts.push_back(SDL_Vertex{ { left + cell.w, top },          c, { u1, v0 } });
+  verts.push_back(SDL_Vertex{ { left,          top + cell.h }, c, { u0, v1 } });
+  verts.push_back(SDL_Vertex{ { left + cell.w, top + cell.h }, c, { u1, v1 } });
+  const int quad[6] = { base, base + 1, base + 2, base + 1, base + 3, base + 2 };
+  indices.insert(indices.end(), quad, quad + 6);
+}
+
+void SdfFont::submit(RenderQueue& q, uint8_t layer, SDL_Texture* tex) {
+  if (m_verts.empty()) return;
+  q.geometry(layer, tex, m_verts.data(), (int)m_verts.size(),
+             m_indices.data(), (int)m_indices.size());
+}
+
+void SdfFont::draw(RenderQueue& q, uint8_t layer, const TextLayout& l,
+                   float x, float y, SDL_Color c) {
+  if (!ready() || l.glyphs.empty() || l.px <= 0.f) return;
+
+  Baked* b = baked((int)std::lround(l.px));
+  SDL_Texture* tex = m_textures->get(b->tex);
+  if (!tex) return;
+
+  m_verts.clear();
+  m_indices.clear();
+  for (const TextLayout::Glyph& g : l.glyphs) addQuad(*b, g.index, x + g.x, y + g.y, c, m_verts, m_indices);
+  submit(q, layer, tex);
+}
+
+float SdfFont::drawRun(RenderQueue& q, uint8_t layer, const char* begin, const char* end,
+                       float x, float y, float px, SDL_Color c) {
+  if (!ready() || begin >= end || px <= 0.f) return 0.f;
+
+  Baked* b = baked((int)std::lround(px));
+  SDL_Texture* tex = m_textures->get(b->tex);
+
+  m_verts.clear();
+  m_indices.clear();
+  float pen = 0.f;
+  int prev = -1;
+  for (const char* p = begin; p < end; p++) {
+    const int g = glyphIndex((uint8_t)*p);
+    if (prev >= 0) pen += kerning(prev, g) * b->scale;
+    addQuad(*b, g, x + pen, y, c, m_verts, m_indices);
+    pen += m_glyphs[(size_t)g].advance * b->scale;
+    prev = g;
+  }
+  if (tex) submit(q, layer, tex);
+  return pen;
+}
+
+void SdfFont::append(const TextLayout& l, float x, float y, SDL_Color c,
+                     std::vector<SDL_Vertex>& verts, std::vector<int>& indices) {
+  if (!ready() || l.glyphs.empty() || l.px <= 0.f) return;
+
+  // Cells depend only on the pixel size, so these quads stay valid even if
+  // trim() drops the size and it is baked again later
+  const Baked* b = baked((int)std::lround(l.px));
+  for (const TextLayout::Glyph& g : l.glyphs) addQuad(*b, g.index, x + g.x, y + g.y, c, verts, indices);
+}
+
+SDL_Texture* SdfFont::texture(float px) {
+  if (!ready()) return nullptr;
+  return m_textures->get(baked((int)std::lround(px))->tex);
+}
+
+void SdfFont::paint(const TextLayout& l, float x, float y, SDL_Color c,
+                    uint32_t* argb, int w, int h) const {
+  if (m_lineH <= 0 || l.glyphs.empty() || l.px <= 0.f) return;
+
+  // The cell geometry of baked(px), without baking the whole size
+  const int px = std::max((int)std::lround(l.px), 4);
+  const float scale = (float)px / (float)m_lineH;
+  const int pad = std::max(1, (int)std::ceil(SPREAD * scale));
+
+  for (const TextLayout::Glyph& g : l.glyphs) {
+    const Glyph& glyph = m_glyphs[g.index];
+    if (glyph.imgW <= 0) continue;
+    const int left = (int)std::round(x + g.x) - pad;
+    const int top = (int)std::round(y + g.y) - pad;
+    const int cellW = (int)std::ceil(glyph.imgW * scale) + 2 * pad;
+    const int cellH = px + 2 * pad;
+
+    for (int oy = std::max(0, -top); oy < cellH && top + oy < h; oy++) {
+      uint32_t* row = argb + (size_t)(top + oy) * w;
+      for (int ox = std::max(0, -left); ox < cellW && left + ox < w; ox++) {
+        float a = 0.f;
+        if (!coverage(glyph.cell, scale, pad, ox, oy, a)) continue;
+        a *= c.a / 255.f;
+        if (a <= 0.f) continue;
+
+        // Straight-alpha source over destination
+        const uint32_t d = row[left + ox];
+        const float da = (float)(d >> 24) / 255.f * (1.f - a);
+        const float oa = a + da;
+        auto mix = [&](int shift, Uint8 s) {
+          const float v = (s * a + (float)((d >> shift) & 0xFF) * da) / oa;
+          return (uint32_t)(v + 0.5f) << shift;
+        };
+        row[left + ox] = ((uint32_t)(oa * 255.f + 0.5f) << 24) |
+                         mix(16, c.r) | mix(8, c.g) | mix(0, c.b);
+      }
+    }
+  }
+}
+
+void SdfFont::draw(RenderQueue& q, uint8_t layer, const char* text,
+                   float x, float y, float px, SDL_Color c) {
+  TextStyle style;
+  style.px = px;
+  draw(q, layer, layout(text, style), x, y, c);
+}
+
+void SdfFont::drawCentered(RenderQueue& q, uint8_t layer, const char* text,
+                           const SDL_FRect& box, float px, SDL_Color c) {
+  TextStyle style;
+  style.px = px;
+  style.width = box.w;
+  style.align = TextAlign::Center;
+  style.wrap = true;
+  style.ellipsis = true;
+  style.maxLines = std::max(1, (int)(box.h / px));
+  const TextLayout& l = layout(text, style);
+  draw(q, layer, l, box.x, box.y + (box.h - l.height) * 0.5f, c);
+}
+
+void SdfFont::trim() {
+  if (m_layouts.size() > MAX_LAYOUTS) {
+    for (auto it = m_layouts.begin(); it != m_layouts.end();) {
+      if (!it->second.used) it = m_layouts.erase(it);
+      else ++it;
+    }
+  }
+  for (auto& l : m_layouts) l.second.used = false;
+
+  if (m_baked.size() <= MAX_BAKED) {
+    for (auto& b : m_baked) b.second.used = false;
+    return;
+  }
+
+  for (auto it = m_baked.begin(); it != m_baked.end();) {
+    if (!it->second.used && m_baked.size() > MAX_BAKED) {
+      m_textures->remove(it->second.tex);
+      it = m_baked.erase(it);
+    } else {
+      it->second.used = false;
+      ++it;
+    }
+  }
+}
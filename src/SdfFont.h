@@ -0,0 +1,148 @@
+// src/SdfFont.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <SDL2/SDL_ttf.h>
+#include <cstdint>
+#include <map>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+#include "RenderQueue.h"
+#include "TextLayout.h"
+#include "TextureRegistry.h"
+
+// Resolution-independent text from a signed distance field glyph atlas.
+//
+// build() rasterizes printable ASCII once with SDL_ttf and stores a distance
+// field per glyph (8-bit, edge at 128). SDL_Renderer has no programmable
+// shading, so the distance threshold can't run per pixel on the GPU;
+// instead each pixel size is baked from the field into a white + coverage
+// texture the first time it is drawn (one pass over the atlas, no TTF
+// work), and glyph quads are snapped to whole pixels so that texture is
+// sampled 1:1 on both backends. Baked sizes live in the TextureRegistry and
+// regenerate from the field after a renderer rebuild.
+//
+// Text is recorded as textured geometry: every string of one size shares a
+// texture, so the RenderQueue merges them into one draw call.
+//
+// Metrics (advance, ink extent, kerning pairs) are captured with the field,
+// so measuring and laying out never calls SDL_ttf. Strings are UTF-8; code
+// points outside printable ASCII draw as '?'.
+class SdfFont {
+public:
+  SdfFont() = default;
+  ~SdfFont();
+
+  SdfFont(const SdfFont&) = delete;
+  SdfFont& operator=(const SdfFont&) = delete;
+
+  // Build the field from `font` (any size; larger means sharper upscales).
+  // Only touches this object and the font, so it may run on a loader
+  // thread; the font is usable once attach() has run on the main thread.
+  // `textures` must outlive this object.
+  bool build(TTF_Font* font);
+  void attach(TextureRegistry& textures);
+  bool ready() const { return m_textures != nullptr; }
+
+  // Line height of the source font; `px` arguments below are line heights
+  float baseHeight() const { return (float)m_lineH; }
+
+  // Width of `text` on one line at line height `px`
+  float measure(const char* text, float px);
+
+  // Cached by string and style. The reference stays valid until trim().
+  const TextLayout& layout(const char* text, const TextStyle& style);
+
+  // Layout box top-left at (x, y)
+  void draw(RenderQueue& q, uint8_t layer, const TextLayout& layout,
+            float x, float y, SDL_Color c);
+  void draw(RenderQueue& q, uint8_t layer, const char* text,
+            float x, float y, float px, SDL_Color c);
+
+  // ASCII run [begin, end) on one line, bypassing the layout cache (for
+  // text that changes every frame, like numbers); returns its advance.
+  // Reuses internal buffers: no allocation once warmed up.
+  float drawRun(RenderQueue& q, uint8_t layer, const char* begin, const char* end,
+                float x, float y, float px, SDL_Color c);
+  // Centered both ways in `box`; wraps to its width
+  void drawCentered(RenderQueue& q, uint8_t layer, const char* text,
+                    const SDL_FRect& box, float px, SDL_Color c);
+
+  // Retained text: glyph quads of `layout` (box top-left at (x, y)) are
+  // appended to caller-owned buffers, to be drawn with texture(layout.px).
+  // texture() must be fetched every frame; it also keeps the size baked.
+  void append(const TextLayout& layout, float x, float y, SDL_Color c,
+              std::vector<SDL_Vertex>& verts, std::vector<int>& indices);
+  SDL_Texture* texture(float px);
+
+  // Composites `layout` (box top-left at (x, y)) over a w x h ARGB8888
+  // image, straight alpha, for text baked into a texture together with
+  // other content. Glyphs land on the same pixels draw() would cover.
+  void paint(const TextLayout& layout, float x, float y, SDL_Color c,
+             uint32_t* argb, int w, int h) const;
+
+  // Drop baked sizes and layouts beyond the cache limits that weren't used
+  // since the last trim. Call after the frame was flushed (textures may be
+  // in use).
+  void trim();
+
+private:
+  static constexpr int FIRST = 32;  // ' '
+  static constexpr int LAST  = 126; // '~'
+  static constexpr int SPREAD = 4;  // field range in source pixels
+
+  static constexpr int COUNT = LAST - FIRST + 1;
+
+  struct Glyph {
+    SDL_Rect cell{};      // in m_field, includes SPREAD padding
+    int      imgW = 0;    // rasterized width (without padding)
+    float    advance = 0.f;
+    float    inkRight = 0.f; // right edge of the outline from the pen (maxx)
+  };
+
+  struct CachedLayout {
+    std::string text;
+    TextStyle   style;
+    TextLayout  layout;
+    bool        built = false;
+    bool        used = false;
+  };
+
+  struct Baked {
+    int px = 0;
+    int pad = 0;          // output pixels of padding around each glyph
+    int w = 0, h = 0;
+    float scale = 1.f;
+    std::vector<SDL_Rect> cells; // per glyph, in the baked texture
+    TextureRegistry::Handle tex = 0;
+    bool used = false;
+  };
+
+  static int glyphIndex(uint32_t codepoint);
+  float        kerning(int left, int right) const { return m_kerning[(size_t)left * COUNT + right]; }
+  void         buildLayout(const char* text, const TextStyle& style, TextLayout& out);
+  Baked*       baked(int px);
+  void         addQuad(const Baked& b, int index, float x, float y, SDL_Color c,
+                       std::vector<SDL_Vertex>& verts, std::vector<int>& indices) const;
+  void         submit(RenderQueue& q, uint8_t layer, SDL_Texture* tex);
+  void         layoutBaked(Baked& b) const;
+  void         bake(const Baked& b, uint32_t* out) const;
+  bool         coverage(const SDL_Rect& src, float scale, int pad, int ox, int oy,
+                        float& a) const;
+  float        sample(float x, float y) const; // bilinear, source pixels
+
+  TextureRegistry*     m_textures = nullptr;
+  std::vector<Glyph>   m_glyphs;
+  std::vector<int8_t>  m_kerning; // COUNT x COUNT, source pixels
+  std::vector<uint8_t> m_field;
+  int m_fieldW = 0, m_fieldH = 0;
+  int m_lineH = 0;
+
+  std::map<int, Baked> m_baked; // by pixel size; nodes stay put
+  std::unordered_map<uint64_t, CachedLayout> m_layouts; // by text+style hash
+  std::vector<int>        m_codepoints; // layout scratch (glyph indices)
+  std::vector<SDL_Vertex> m_verts;
+  std::vector<int>        m_indices;
+};
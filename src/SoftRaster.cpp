@@ -0,0 +1,621 @@
+// src/SoftRaster.cpp
+#include "SoftRaster.h"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdio>
+#include <cstring>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFT_RASTER_SSE2 1
+#endif
+
+// ---------------- Pixel spans ----------------
+//
+// The frame is always opaque, so every span writes alpha 255. The SSE2 and
+// scalar paths compute the same values (x * a / 255, rounded).
+
+static inline uint32_t toArgb(SDL_Color c) {
+  return ((uint32_t)c.a << 24) | ((uint32_t)c.r << 16) | ((uint32_t)c.g << 8) | c.b;
+}
+
+static inline uint32_t mul255(uint32_t a, uint32_t b) {
+  uint32_t t = a * b + 128;
+  return (t + (t >> 8)) >> 8;
+}
+
+static inline uint32_t blend1(uint32_t s, uint32_t d) {
+  const uint32_t a = s >> 24, ia = 255 - a;
+  uint32_t out = 0xFF000000u;
+  for (int sh = 0; sh <= 16; sh += 8) {
+    uint32_t t = ((s >> sh) & 255) * a + ((d >> sh) & 255) * ia + 128;
+    out |= ((t + (t >> 8)) >> 8) << sh;
+  }
+  return out;
+}
+
+// Multiply every channel (alpha included) by a color/alpha mod
+static inline uint32_t modulate(uint32_t px, uint32_t m) {
+  if (m == 0xFFFFFFFFu) return px;
+  uint32_t out = 0;
+  for (int sh = 0; sh <= 24; sh += 8) {
+    out |= mul255((px >> sh) & 255, (m >> sh) & 255) << sh;
+  }
+  return out;
+}
+
+#ifdef SOFT_RASTER_SSE2
+// Blend four straight-alpha pixels over four destination pixels
+static inline __m128i blend4(__m128i s, __m128i d) {
+  const __m128i zero = _mm_setzero_si128();
+  const __m128i c255 = _mm_set1_epi16(255);
+  const __m128i c128 = _mm_set1_epi16(128);
+
+  __m128i a = _mm_srli_epi32(s, 24);
+  __m128i aLo = _mm_unpacklo_epi32(a, a);
+  __m128i aHi = _mm_unpackhi_epi32(a, a);
+  aLo = _mm_or_si128(aLo, _mm_slli_epi32(aLo, 16));
+  aHi = _mm_or_si128(aHi, _mm_slli_epi32(aHi, 16));
+
+  auto half = [&](__m128i s16, __m128i d16, __m128i a16) {
+    __m128i t = _mm_add_epi16(_mm_mullo_epi16(s16, a16),
+                              _mm_mullo_epi16(d16, _mm_sub_epi16(c255, a16)));
+    t = _mm_add_epi16(t, c128);
+    return _mm_srli_epi16(_mm_add_epi16(t, _mm_srli_epi16(t, 8)), 8);
+  };
+
+  __m128i lo = half(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), aLo);
+  __m128i hi = half(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), aHi);
+  return _mm_or_si128(_mm_packus_epi16(lo, hi), _mm_set1_epi32((int)0xFF000000u));
+}
+#endif
+
+static void fillSpan(uint32_t* d, int n, uint32_t c) {
+  c |= 0xFF000000u;
+  int i = 0;
+#ifdef SOFT_RASTER_SSE2
+  const __m128i v = _mm_set1_epi32((int)c);
+  for (; i + 4 <= n; i += 4) _mm_storeu_si128((__m128i*)(d + i), v);
+#endif
+  for (; i < n; i++) d[i] = c;
+}
+
+static void blendSolidSpan(uint32_t* d, int n, uint32_t c) {
+  int i = 0;
+#ifdef SOFT_RASTER_SSE2
+  const __m128i s = _mm_set1_epi32((int)c);
+  for (; i + 4 <= n; i += 4) {
+    __m128i dst = _mm_loadu_si128((const __m128i*)(d + i));
+    _mm_storeu_si128((__m128i*)(d + i), blend4(s, dst));
+  }
+#endif
+  for (; i < n; i++) d[i] = blend1(c, d[i]);
+}
+
+static void blendSpan(uint32_t* d, const uint32_t* s, int n) {
+  int i = 0;
+#ifdef SOFT_RASTER_SSE2
+  for (; i + 4 <= n; i += 4) {
+    __m128i src = _mm_loadu_si128((const __m128i*)(s + i));
+    __m128i dst = _mm_loadu_si128((const __m128i*)(d + i));
+    _mm_storeu_si128((__m128i*)(d + i), blend4(src, dst));
+  }
+#endif
+  for (; i < n; i++) d[i] = blend1(s[i], d[i]);
+}
+
+static void copySpan(uint32_t* d, const uint32_t* s, int n) {
+  for (int i = 0; i < n; i++) d[i] = s[i] | 0xFF000000u;
+}
+
+// ---------------- Rect helpers ----------------
+
+static bool intersect(const SDL_Rect& a, const SDL_Rect& b, SDL_Rect& out) {
+  int x0 = std::max(a.x, b.x), y0 = std::max(a.y, b.y);
+  int x1 = std::min(a.x + a.w, b.x + b.w), y1 = std::min(a.y + a.h, b.y + b.h);
+  out = SDL_Rect{ x0, y0, x1 - x0, y1 - y0 };
+  return x1 > x0 && y1 > y0;
+}
+
+// Pixels whose centers fall inside a float rect (SDL's fill convention)
+static SDL_Rect coveredPixels(const SDL_FRect& r) {
+  int x0 = (int)std::ceil(r.x - 0.5f), y0 = (int)std::ceil(r.y - 0.5f);
+  int x1 = (int)std::ceil(r.x + r.w - 0.5f), y1 = (int)std::ceil(r.y + r.h - 0.5f);
+  return SDL_Rect{ x0, y0, x1 - x0, y1 - y0 };
+}
+
+// ---------------- Setup ----------------
+
+SoftRaster::SoftRaster(int threads) {
+  if (threads <= 0) threads = SDL_GetCPUCount();
+  threads = std::max(1, std::min(threads, 16));
+
+  for (int i = 1; i < threads; i++) {
+    m_workers.emplace_back([this] { workerLoop(); });
+  }
+}
+
+SoftRaster::~SoftRaster() {
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_quit = true;
+  }
+  m_wake.notify_all();
+  for (auto& t : m_workers) t.join();
+
+  if (m_stream) SDL_DestroyTexture(m_stream);
+  if (m_frame) SDL_FreeSurface(m_frame);
+}
+
+void SoftRaster::rendererReset() {
+  // SDL freed the textures with the renderer; the pointers may be reused
+  m_stream = nullptr;
+  m_streamRenderer = nullptr;
+  m_textures.clear();
+}
+
+void SoftRaster::setTexturePixels(SDL_Texture* tex, const void* pixels, int w, int h, Uint32 format) {
+  if (!tex || !pixels || w <= 0 || h <= 0) return;
+  if (format != SDL_PIXELFORMAT_ARGB8888 && format != SDL_PIXELFORMAT_RGBA32) {
+    std::printf("SoftRaster: unsupported texture format %u\n", (unsigned)format);
+    return;
+  }
+
+  Image& img = m_textures[tex];
+  img.w = w;
+  img.h = h;
+  img.px.resize((size_t)w * h);
+
+  if (format == SDL_PIXELFORMAT_ARGB8888) {
+    std::memcpy(img.px.data(), pixels, img.px.size() * 4);
+  } else {
+    const uint8_t* p = (const uint8_t*)pixels; // R, G, B, A bytes
+    for (size_t i = 0; i < img.px.size(); i++, p += 4) {
+      img.px[i] = ((uint32_t)p[3] << 24) | ((uint32_t)p[0] << 16) | ((uint32_t)p[1] << 8) | p[2];
+    }
+  }
+}
+
+void SoftRaster::forgetTexture(SDL_Texture* tex) {
+  m_textures.erase(tex);
+}
+
+const SoftRaster::Image* SoftRaster::imageFor(SDL_Texture* tex) const {
+  auto it = m_textures.find(tex);
+  return (it != m_textures.end()) ? &it->second : nullptr;
+}
+
+// ---------------- Recording ----------------
+
+void SoftRaster::begin(int w, int h, const SDL_Rect* clip, float scale) {
+  w = std::max(w, 1);
+  h = std::max(h, 1);
+  m_scale = scale;
+
+  if (!m_frame || m_frame->w != w || m_frame->h != h) {
+    if (m_frame) SDL_FreeSurface(m_frame);
+    m_frame = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!m_frame) std::printf("SoftRaster: frame surface failed: %s\n", SDL_GetError());
+    m_resized = true;
+  }
+
+  // A new surface holds garbage, so it has to be drawn in full
+  m_clip = SDL_Rect{ 0, 0, w, h };
+  if (clip && !m_resized && !intersect(m_clip, *clip, m_clip)) m_clip = SDL_Rect{ 0, 0, 0, 0 };
+
+  m_prims.clear();
+  m_triVerts.clear();
+
+  m_tilesX = (w + TILE - 1) / TILE;
+  m_tilesY = (h + TILE - 1) / TILE;
+  m_bins.resize((size_t)m_tilesX * m_tilesY);
+  for (auto& b : m_bins) b.clear();
+}
+
+SDL_FRect SoftRaster::scaled(const SDL_FRect& r) const {
+  if (m_scale == 1.f) return r;
+  return SDL_FRect{ r.x * m_scale, r.y * m_scale, r.w * m_scale, r.h * m_scale };
+}
+
+void SoftRaster::add(Prim& p, SDL_Rect box) {
+  if (!m_frame || !intersect(box, m_clip, p.box)) return;
+
+  const uint32_t index = (uint32_t)m_prims.size();
+  m_prims.push_back(p);
+
+  const int tx0 = p.box.x / TILE, tx1 = (p.box.x + p.box.w - 1) / TILE;
+  const int ty0 = p.box.y / TILE, ty1 = (p.box.y + p.box.h - 1) / TILE;
+  for (int ty = ty0; ty <= ty1; ty++) {
+    for (int tx = tx0; tx <= tx1; tx++) m_bins[(size_t)ty * m_tilesX + tx].push_back(index);
+  }
+}
+
+void SoftRaster::clear(SDL_Color c) {
+  Prim p;
+  p.type = Type::Fill;
+  p.color = toArgb(c);
+  add(p, m_clip);
+}
+
+void SoftRaster::fillRect(const SDL_FRect& rect, SDL_Color c) {
+  Prim p;
+  p.type = Type::Fill;
+  p.color = toArgb(c);
+  add(p, coveredPixels(scaled(rect)));
+}
+
+void SoftRaster::line(float x1, float y1, float x2, float y2, SDL_Color c) {
+  Prim p;
+  p.type = Type::Line;
+  p.color = toArgb(c);
+  const float k = m_scale;
+  p.geom = SDL_FRect{ std::floor(x1 * k), std::floor(y1 * k), std::floor(x2 * k), std::floor(y2 * k) };
+
+  int bx0 = (int)std::min(p.geom.x, p.geom.w), bx1 = (int)std::max(p.geom.x, p.geom.w);
+  int by0 = (int)std::min(p.geom.y, p.geom.h), by1 = (int)std::max(p.geom.y, p.geom.h);
+  add(p, SDL_Rect{ bx0, by0, bx1 - bx0 + 1, by1 - by0 + 1 });
+}
+
+void SoftRaster::triangle(const Image* img, bool blend, SDL_Vertex a, SDL_Vertex b, SDL_Vertex c) {
+  for (SDL_Vertex* v : { &a, &b, &c }) {
+    v->position.x *= m_scale;
+    v->position.y *= m_scale;
+  }
+
+  Prim p;
+  p.type = Type::Triangle;
+  p.blend = blend;
+  p.img = img;
+  p.first = (uint32_t)m_triVerts.size();
+
+  float x0 = std::min({ a.position.x, b.position.x, c.position.x });
+  float x1 = std::max({ a.position.x, b.position.x, c.position.x });
+  float y0 = std::min({ a.position.y, b.position.y, c.position.y });
+  float y1 = std::max({ a.position.y, b.position.y, c.position.y });
+  SDL_Rect box { (int)std::floor(x0), (int)std::floor(y0), 0, 0 };
+  box.w = (int)std::ceil(x1) - box.x + 1;
+  box.h = (int)std::ceil(y1) - box.y + 1;
+
+  const size_t before = m_prims.size();
+  add(p, box);
+  if (m_prims.size() != before) {
+    m_triVerts.push_back(a);
+    m_triVerts.push_back(b);
+    m_triVerts.push_back(c);
+  }
+}
+
+void SoftRaster::geometry(SDL_Texture* tex, const SDL_Vertex* verts, int vertCount,
+                          const int* indices, int indexCount) {
+  if (!verts || vertCount <= 0) return;
+
+  const Image* img = nullptr;
+  bool blend = false; // untextured geometry uses the draw blend mode (none)
+  if (tex) {
+    img = imageFor(tex);
+    if (!img) return; // no CPU copy (render target?): nothing to sample
+    SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+    SDL_GetTextureBlendMode(tex, &mode);
+    blend = (mode != SDL_BLENDMODE_NONE);
+  }
+
+  const int n = indices ? indexCount : vertCount;
+  for (int i = 0; i + 2 < n; i += 3) {
+    int i0 = indices ? indices[i] : i;
+    int i1 = indices ? indices[i + 1] : i + 1;
+    int i2 = indices ? indices[i + 2] : i + 2;
+    if (i0 < 0 || i1 < 0 || i2 < 0 || i0 >= vertCount || i1 >= vertCount || i2 >= vertCount) continue;
+    triangle(img, blend, verts[i0], verts[i1], verts[i2]);
+  }
+}
+
+void SoftRaster::texture(SDL_Texture* tex, const SDL_Rect* src, const SDL_FRect& dst) {
+  const Image* img = imageFor(tex);
+  if (!img) return;
+
+  Prim p;
+  p.type = Type::Blit;
+  p.img = img;
+  p.src = src ? *src : SDL_Rect{ 0, 0, img->w, img->h };
+  p.geom = scaled(dst);
+
+  SDL_BlendMode mode = SDL_BLENDMODE_NONE;
+  SDL_GetTextureBlendMode(tex, &mode);
+  p.blend = (mode != SDL_BLENDMODE_NONE);
+
+  Uint8 r = 255, g = 255, b = 255, a = 255;
+  SDL_GetTextureColorMod(tex, &r, &g, &b);
+  SDL_GetTextureAlphaMod(tex, &a);
+  p.color = toArgb(SDL_Color{ r, g, b, a });
+
+  if (p.src.w <= 0 || p.src.h <= 0) return;
+  add(p, coveredPixels(p.geom));
+}
+
+// ---------------- Rasterization ----------------
+
+void SoftRaster::workerLoop() {
+  std::vector<uint32_t> scratch;
+  unsigned seen = 0;
+
+  for (;;) {
+    {
+      std::unique_lock<std::mutex> lock(m_mutex);
+      m_wake.wait(lock, [&] { return m_quit || m_job != seen; });
+      if (m_quit) return;
+      seen = m_job;
+    }
+
+    runTiles(scratch);
+
+    {
+      std::lock_guard<std::mutex> lock(m_mutex);
+      if (--m_active == 0) m_done.notify_one();
+    }
+  }
+}
+
+void SoftRaster::runTiles(std::vector<uint32_t>& scratch) {
+  const int count = m_tilesX * m_tilesY;
+  for (;;) {
+    int tile = m_nextTile.fetch_add(1, std::memory_order_relaxed);
+    if (tile >= count) break;
+    rasterTile(tile, scratch);
+  }
+}
+
+void SoftRaster::rasterize() {
+  if (!m_frame || m_prims.empty()) return;
+
+  m_nextTile.store(0, std::memory_order_relaxed);
+  if (m_workers.empty()) {
+    runTiles(m_mainScratch);
+    return;
+  }
+
+  {
+    std::lock_guard<std::mutex> lock(m_mutex);
+    m_job++;
+    m_active = (int)m_workers.size();
+  }
+  m_wake.notify_all();
+
+  runTiles(m_mainScratch);
+
+  std::unique_lock<std::mutex> lock(m_mutex);
+  m_done.wait(lock, [&] { return m_active == 0; });
+}
+
+void SoftRaster::rasterTile(int tile, std::vector<uint32_t>& scratch) {
+  const std::vector<uint32_t>& bin = m_bins[(size_t)tile];
+  if (bin.empty()) return;
+
+  const SDL_Rect tileRect { (tile % m_tilesX) * TILE, (tile / m_tilesX) * TILE, TILE, TILE };
+  SDL_Rect tileArea;
+  if (!intersect(tileRect, m_clip, tileArea)) return;
+
+  // Bins hold indices in recording order, so painter's order is preserved
+  for (uint32_t index : bin) {
+    const Prim& p = m_prims[index];
+    SDL_Rect area;
+    if (!intersect(tileArea, p.box, area)) continue;
+
+    switch (p.type) {
+      case Type::Fill:     drawFill(p, area); break;
+      case Type::Line:     drawLine(p, area); break;
+      case Type::Triangle: drawTriangle(p, area, scratch); break;
+      case Type::Blit:     drawBlit(p, area, scratch); break;
+    }
+  }
+}
+
+static inline uint32_t* rowPtr(SDL_Surface* s, int y) {
+  return (uint32_t*)((uint8_t*)s->pixels + (size_t)y * s->pitch);
+}
+
+void SoftRaster::drawFill(const Prim& p, const SDL_Rect& area) {
+  for (int y = area.y; y < area.y + area.h; y++) {
+    fillSpan(rowPtr(m_frame, y) + area.x, area.w, p.color);
+  }
+}
+
+void SoftRaster::drawLine(const Prim& p, const SDL_Rect& area) {
+  // Bresenham with both endpoints included, like SDL_RenderDrawLine;
+  // each tile walks the line and keeps its own pixels.
+  int x0 = (int)p.geom.x, y0 = (int)p.geom.y;
+  const int x1 = (int)p.geom.w, y1 = (int)p.geom.h;
+  const int dx = std::abs(x1 - x0), sx = x0 < x1 ? 1 : -1;
+  const int dy = -std::abs(y1 - y0), sy = y0 < y1 ? 1 : -1;
+  int err = dx + dy;
+  const uint32_t c = p.color | 0xFF000000u;
+
+  for (;;) {
+    if (x0 >= area.x && x0 < area.x + area.w && y0 >= area.y && y0 < area.y + area.h) {
+      rowPtr(m_frame, y0)[x0] = c;
+    }
+    if (x0 == x1 && y0 == y1) break;
+    int e2 = 2 * err;
+    if (e2 >= dy) { err += dy; x0 += sx; }
+    if (e2 <= dx) { err += dx; y0 += sy; }
+  }
+}
+
+void SoftRaster::drawTriangle(const Prim& p, const SDL_Rect& area, std::vector<uint32_t>& scratch) {
+  const SDL_Vertex* v[3] = { &m_triVerts[p.first], &m_triVerts[p.first + 1], &m_triVerts[p.first + 2] };
+
+  float area2 = (v[1]->position.x - v[0]->position.x) * (v[2]->position.y - v[0]->position.y) -
+                (v[1]->position.y - v[0]->position.y) * (v[2]->position.x - v[0]->position.x);
+  if (area2 == 0.f) return;
+  if (area2 < 0.f) {
+    std::swap(v[1], v[2]);
+    area2 = -area2;
+  }
+
+  // Edge i runs from v[i] to v[i+1]; its function is >= 0 inside.
+  // Pixels exactly on an edge go to top/left edges only, so triangles that
+  // share an edge (quads) never blend a pixel twice.
+  struct Edge { float ax, ay, dx, dy; bool owns; };
+  Edge e[3];
+  for (int i = 0; i < 3; i++) {
+    const SDL_FPoint& a = v[i]->position;
+    const SDL_FPoint& b = v[(i + 1) % 3]->position;
+    e[i] = Edge{ a.x, a.y, b.x - a.x, b.y - a.y, false };
+    e[i].owns = (e[i].dy > 0.f) || (e[i].dy == 0.f && e[i].dx < 0.f);
+  }
+  auto inside = [&](float px, float py, float w[3]) {
+    for (int i = 0; i < 3; i++) {
+      w[i] = e[i].dx * (py - e[i].ay) - e[i].dy * (px - e[i].ax);
+      if (w[i] < 0.f || (w[i] == 0.f && !e[i].owns)) return false;
+    }
+    return true;
+  };
+
+  const bool flat =
+    std::memcmp(&v[0]->color, &v[1]->color, sizeof(SDL_Color)) == 0 &&
+    std::memcmp(&v[0]->color, &v[2]->color, sizeof(SDL_Color)) == 0;
+  const uint32_t flatColor = toArgb(v[0]->color);
+  const bool solid = flat && !p.img;
+  const float inv = 1.f / area2;
+
+  if ((int)scratch.size() < area.w) scratch.resize((size_t)area.w);
+
+  for (int y = area.y; y < area.y + area.h; y++) {
+    const float py = y + 0.5f;
+    float w[3];
+
+    // Convex: inside pixels of a row are contiguous. Solve each edge for
+    // its x bound, then settle the ends with the exact test.
+    float lo = (float)area.x, hi = (float)(area.x + area.w);
+    bool empty = false;
+    for (int i = 0; i < 3 && !empty; i++) {
+      const float k = e[i].dx * (py - e[i].ay) + e[i].dy * e[i].ax; // E = k - dy * px
+      if (e[i].dy > 0.f)      hi = std::min(hi, k / e[i].dy);
+      else if (e[i].dy < 0.f) lo = std::max(lo, k / e[i].dy);
+      else                    empty = (k < 0.f);
+    }
+    if (empty || lo > hi + 1.f) continue;
+
+    const int right = area.x + area.w;
+    int xs = std::max(area.x, (int)std::ceil(lo - 0.5f) - 1);
+    int xe = std::min(right, (int)std::floor(hi - 0.5f) + 2);
+    while (xs < xe && !inside(xs + 0.5f, py, w)) xs++;
+    while (xe > xs && !inside(xe - 0.5f, py, w)) xe--;
+    if (xe <= xs) continue;
+
+    uint32_t* dst = rowPtr(m_frame, y) + xs;
+    const int n = xe - xs;
+
+    if (solid) {
+      if (p.blend && (flatColor >> 24) != 255) blendSolidSpan(dst, n, flatColor);
+      else                                     fillSpan(dst, n, flatColor);
+      continue;
+    }
+
+    for (int x = xs; x < xe; x++) {
+      // Edge i's function is the weight of the vertex opposite it
+      const float px = x + 0.5f;
+      const float b0 = (e[1].dx * (py - e[1].ay) - e[1].dy * (px - e[1].ax)) * inv;
+      const float b1 = (e[2].dx * (py - e[2].ay) - e[2].dy * (px - e[2].ax)) * inv;
+      const float b2 = 1.f - b0 - b1;
+
+      uint32_t col = flatColor;
+      if (!flat) {
+        auto lerp = [&](Uint8 c0, Uint8 c1, Uint8 c2) {
+          float f = c0 * b0 + c1 * b1 + c2 * b2;
+          return (uint32_t)std::min(255.f, std::max(0.f, f + 0.5f));
+        };
+        col = (lerp(v[0]->color.a, v[1]->color.a, v[2]->color.a) << 24) |
+              (lerp(v[0]->color.r, v[1]->color.r, v[2]->color.r) << 16) |
+              (lerp(v[0]->color.g, v[1]->color.g, v[2]->color.g) << 8) |
+               lerp(v[0]->color.b, v[1]->color.b, v[2]->color.b);
+      }
+      if (p.img) {
+        float u = v[0]->tex_coord.x * b0 + v[1]->tex_coord.x * b1 + v[2]->tex_coord.x * b2;
+        float t = v[0]->tex_coord.y * b0 + v[1]->tex_coord.y * b1 + v[2]->tex_coord.y * b2;
+        int tx = std::min(p.img->w - 1, std::max(0, (int)std::floor(u * p.img->w)));
+        int ty = std::min(p.img->h - 1, std::max(0, (int)std::floor(t * p.img->h)));
+        col = modulate(p.img->px[(size_t)ty * p.img->w + tx], col);
+      }
+      scratch[x - xs] = col;
+    }
+
+    if (p.blend) blendSpan(dst, scratch.data(), n);
+    else         copySpan(dst, scratch.data(), n);
+  }
+}
+
+void SoftRaster::drawBlit(const Prim& p, const SDL_Rect& area, std::vector<uint32_t>& scratch) {
+  const Image& img = *p.img;
+  const SDL_FRect& d = p.geom;
+  const SDL_Rect& s = p.src;
+
+  const float su = s.w / d.w, sv = s.h / d.h;
+  const bool unscaled = (s.w == (int)d.w && s.h == (int)d.h && d.w == std::floor(d.w));
+  const bool plain = (p.color == 0xFFFFFFFFu);
+
+  if ((int)scratch.size() < area.w) scratch.resize((size_t)area.w);
+
+  for (int y = area.y; y < area.y + area.h; y++) {
+    int ty = s.y + (int)std::floor((y + 0.5f - d.y) * sv);
+    ty = std::min(s.y + s.h - 1, std::max(s.y, ty));
+    ty = std::min(img.h - 1, std::max(0, ty));
+    const uint32_t* srcRow = &img.px[(size_t)ty * img.w];
+
+    const uint32_t* src = nullptr;
+    int tx0 = s.x + (int)std::floor((area.x + 0.5f - d.x) * su);
+
+    if (unscaled && plain && tx0 >= 0 && tx0 + area.w <= img.w) {
+      src = srcRow + tx0; // 1:1 copy straight from the image
+    } else {
+      for (int x = 0; x < area.w; x++) {
+        int tx = s.x + (int)std::floor((area.x + x + 0.5f - d.x) * su);
+        tx = std::min(s.x + s.w - 1, std::max(s.x, tx));
+        tx = std::min(img.w - 1, std::max(0, tx));
+        scratch[x] = modulate(srcRow[tx], p.color);
+      }
+      src = scratch.data();
+    }
+
+    uint32_t* dst = rowPtr(m_frame, y) + area.x;
+    if (p.blend) blendSpan(dst, src, area.w);
+    else         copySpan(dst, src, area.w);
+  }
+}
+
+// ---------------- Output ----------------
+
+void SoftRaster::present(SDL_Renderer* r) {
+  rasterize();
+  if (!r || !m_frame) return;
+
+  const int w = m_frame->w, h = m_frame->h;
+  bool full = m_resized;
+
+  if (m_stream && (m_streamRenderer != r || m_streamW != w || m_streamH != h)) {
+    if (m_streamRenderer == r) SDL_DestroyTexture(m_stream);
+    m_stream = nullptr;
+  }
+  if (!m_stream) {
+    m_stream = SDL_CreateTexture(r, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STREAMING, w, h);
+    if (!m_stream) {
+      std::printf("SoftRaster: streaming texture failed: %s\n", SDL_GetError());
+      return;
+    }
+    SDL_SetTextureBlendMode(m_stream, SDL_BLENDMODE_NONE);
+    SDL_SetTextureScaleMode(m_stream, SDL_ScaleModeLinear); // scaled frames
+    m_streamRenderer = r;
+    m_streamW = w;
+    m_streamH = h;
+    full = true;
+  }
+
+  const SDL_Rect rect = full ? SDL_Rect{ 0, 0, w, h } : m_clip;
+  if (rect.w > 0 && rect.h > 0) {
+    const uint8_t* pixels = (const uint8_t*)m_frame->pixels + (size_t)rect.y * m_frame->pitch + (size_t)rect.x * 4;
+    SDL_UpdateTexture(m_stream, &rect, pixels, m_frame->pitch);
+  }
+  m_resized = false;
+
+  SDL_RenderCopy(r, m_stream, nullptr, nullptr);
+}
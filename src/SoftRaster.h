@@ -0,0 +1,124 @@
+// src/SoftRaster.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <vector>
+
+// CPU rasterizer for RenderQueue output, for machines without a GPU.
+//
+// Commands are recorded in painter's order (RenderQueue::flush(SoftRaster&)
+// replays its sorted queue), binned into 64x64 tiles, and the tiles are
+// rasterized in parallel into an ARGB8888 SDL_Surface. present() uploads the
+// touched rows to one streaming texture, so SDL itself only does a copy.
+//
+// Blending follows SDL: fills, lines and untextured geometry use the default
+// draw blend mode (none), textures their own blend mode and color/alpha mod.
+// Textures must have their pixels registered (setTexturePixels); render
+// target textures can't be read back and draw nothing here.
+class SoftRaster {
+public:
+  explicit SoftRaster(int threads = 0); // 0 = one per CPU core
+  ~SoftRaster();
+
+  SoftRaster(const SoftRaster&) = delete;
+  SoftRaster& operator=(const SoftRaster&) = delete;
+
+  // Start a frame of w x h. With a clip rect only that area is rasterized
+  // and uploaded; the rest keeps the previous frame's pixels. Recorded
+  // coordinates are multiplied by `scale` (dynamic resolution: the frame is
+  // smaller than the window and present() stretches it).
+  void begin(int w, int h, const SDL_Rect* clip = nullptr, float scale = 1.f);
+
+  void clear(SDL_Color c);
+  void fillRect(const SDL_FRect& rect, SDL_Color c);
+  void line(float x1, float y1, float x2, float y2, SDL_Color c);
+  void geometry(SDL_Texture* tex, const SDL_Vertex* verts, int vertCount,
+                const int* indices, int indexCount);
+  void texture(SDL_Texture* tex, const SDL_Rect* src, const SDL_FRect& dst);
+
+  // Rasterize the frame, upload it and copy it to the renderer's back buffer
+  void present(SDL_Renderer* r);
+
+  // CPU copy of a texture's pixels (SDL_PIXELFORMAT_ARGB8888 or RGBA32)
+  void setTexturePixels(SDL_Texture* tex, const void* pixels, int w, int h, Uint32 format);
+  void forgetTexture(SDL_Texture* tex);
+
+  // The renderer was recreated: its textures (ours and registered) are gone
+  void rendererReset();
+
+  // Last rasterized frame (ARGB8888)
+  const SDL_Surface* frame() const { return m_frame; }
+
+  int primitives() const { return (int)m_prims.size(); }
+
+private:
+  struct Image {
+    int w = 0;
+    int h = 0;
+    std::vector<uint32_t> px; // ARGB, straight alpha
+  };
+
+  enum class Type : uint8_t { Fill, Line, Triangle, Blit };
+
+  struct Prim {
+    Type         type = Type::Fill;
+    bool         blend = false;
+    uint32_t     color = 0;    // Fill / Line: ARGB; Blit: color+alpha mod
+    SDL_Rect     box{};        // pixel bounds, already clipped
+    SDL_FRect    geom{};       // Line: x1,y1,x2,y2; Blit: destination
+    SDL_Rect     src{};        // Blit source
+    uint32_t     first = 0;    // Triangle: index of 3 vertices in m_triVerts
+    const Image* img = nullptr;
+  };
+
+  // Commit a primitive whose bounds are box (unclipped)
+  void add(Prim& p, SDL_Rect box);
+  void triangle(const Image* img, bool blend, SDL_Vertex a, SDL_Vertex b, SDL_Vertex c);
+  const Image* imageFor(SDL_Texture* tex) const;
+  SDL_FRect    scaled(const SDL_FRect& r) const;
+
+  void rasterize();
+  void runTiles(std::vector<uint32_t>& scratch);
+  void rasterTile(int tile, std::vector<uint32_t>& scratch);
+  void workerLoop();
+
+  void drawFill(const Prim& p, const SDL_Rect& area);
+  void drawLine(const Prim& p, const SDL_Rect& area);
+  void drawTriangle(const Prim& p, const SDL_Rect& area, std::vector<uint32_t>& scratch);
+  void drawBlit(const Prim& p, const SDL_Rect& area, std::vector<uint32_t>& scratch);
+
+  static constexpr int TILE = 64;
+
+  SDL_Surface* m_frame = nullptr;
+  SDL_Rect     m_clip{};
+  bool         m_resized = false;
+  float        m_scale = 1.f;
+
+  std::vector<Prim>       m_prims;
+  std::vector<SDL_Vertex> m_triVerts;
+  std::unordered_map<SDL_Texture*, Image> m_textures;
+
+  int m_tilesX = 0, m_tilesY = 0;
+  std::vector<std::vector<uint32_t>> m_bins; // prim indices per tile
+
+  SDL_Texture*  m_stream = nullptr;
+  SDL_Renderer* m_streamRenderer = nullptr;
+  int m_streamW = 0, m_streamH = 0;
+
+  // Tile workers: the main thread joins in, so threads - 1 of them
+  std::vector<std::thread> m_workers;
+  std::mutex               m_mutex;
+  std::condition_variable  m_wake;
+  std::condition_variable  m_done;
+  unsigned                 m_job = 0;
+  int                      m_active = 0;
+  bool                     m_quit = false;
+  std::atomic<int>         m_nextTile{ 0 };
+  std::vector<uint32_t>    m_mainScratch;
+};
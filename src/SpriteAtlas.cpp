@@ -0,0 +1,95 @@
+// src/SpriteAtlas.cpp
+#include "SpriteAtlas.h"
+
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <utility>
+
+#include "SpriteAtlasData.h" // generated by the sprite_atlas target
+
+const int SpriteAtlas::QUAD_INDICES[6] = { 0, 1, 2, 1, 3, 2 };
+
+SpriteAtlas::~SpriteAtlas() {
+  clear();
+}
+
+void SpriteAtlas::clear() {
+  if (m_textures) {
+    for (auto& p : m_pages) m_textures->remove(p.tex);
+  }
+  m_pages.clear();
+}
+
+bool SpriteAtlas::read() {
+  m_staged.clear();
+
+  for (int i = 0; i < atlasdata::PAGE_COUNT; i++) {
+    const std::string name = std::string("atlas/") + atlasdata::PAGES[i];
+
+    Page page;
+    page.file = openAsset(name.c_str());
+    if (!page.file) {
+      m_staged.clear();
+      return false;
+    }
+
+    // uint32 LE width, uint32 LE height, then RGBA8 pixels
+    const uint8_t* bytes = page.file.data();
+    const size_t size = page.file.size();
+    if (size >= 8) {
+      page.w = (int)(bytes[0] | (bytes[1] << 8) | (bytes[2] << 16) | ((uint32_t)bytes[3] << 24));
+      page.h = (int)(bytes[4] | (bytes[5] << 8) | (bytes[6] << 16) | ((uint32_t)bytes[7] << 24));
+    }
+    size_t pixelBytes = (size_t)page.w * (size_t)page.h * 4;
+    if (page.w <= 0 || page.h <= 0 || size < 8 + pixelBytes) {
+      std::printf("SpriteAtlas: %s is truncated\n", name.c_str());
+      m_staged.clear();
+      return false;
+    }
+
+    m_staged.push_back(std::move(page));
+  }
+  return true;
+}
+
+void SpriteAtlas::publish(TextureRegistry& textures) {
+  clear();
+  m_textures = &textures;
+
+  for (Page& page : m_staged) {
+    page.tex = textures.addExternal(page.file.data() + 8, page.w, page.h, SDL_PIXELFORMAT_RGBA32);
+    m_pages.push_back(std::move(page));
+  }
+  m_staged.clear();
+}
+
+int SpriteAtlas::find(const char* name) const {
+  if (!name) return -1;
+  for (int i = 0; i < atlasdata::SPRITE_COUNT; i++) {
+    if (std::strcmp(atlasdata::SPRITES[i].name, name) == 0) return i;
+  }
+  return -1;
+}
+
+SDL_Texture* SpriteAtlas::quad(int id, const SDL_FRect& dst, SDL_Vertex out[4], SDL_Color tint) const {
+  if (id < 0 || id >= atlasdata::SPRITE_COUNT) return nullptr;
+
+  const atlasdata::SpriteRect& s = atlasdata::SPRITES[id];
+  if (s.page < 0 || s.page >= (int)m_pages.size()) return nullptr;
+
+  const Page& p = m_pages[s.page];
+  SDL_Texture* tex = m_textures ? m_textures->get(p.tex) : nullptr;
+  if (!tex) return nullptr;
+
+  const float u0 = (float)s.x / p.w;
+  const float v0 = (float)s.y / p.h;
+  const float u1 = (float)(s.x + s.w) / p.w;
+  const float v1 = (float)(s.y + s.h) / p.h;
+
+  out[0] = SDL_Vertex{ { dst.x,         dst.y },         tint, { u0, v0 } };
+  out[1] = SDL_Vertex{ { dst.x + dst.w, dst.y },         tint, { u1, v0 } };
+  out[2] = SDL_Vertex{ { dst.x,         dst.y + dst.h }, tint, { u0, v1 } };
+  out[3] = SDL_Vertex{ { dst.x + dst.w, dst.y + dst.h }, tint, { u1, v1 } };
+  return tex;
+}
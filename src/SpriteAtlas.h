@@ -0,0 +1,55 @@
+// src/SpriteAtlas.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <vector>
+
+#include "Assets.h"
+#include "TextureRegistry.h"
+
+// Runtime side of the sprite atlas built by tools/atlas_packer.cpp.
+//
+// The sprite table is compiled in (generated SpriteAtlasData.h), and so are
+// the page files ("atlas/<page>" assets, see Assets.h). Page pixels are
+// handed to the TextureRegistry in place, without a copy; it re-uploads
+// them after the renderer is recreated.
+class SpriteAtlas {
+public:
+  SpriteAtlas() = default;
+  ~SpriteAtlas();
+
+  SpriteAtlas(const SpriteAtlas&) = delete;
+  SpriteAtlas& operator=(const SpriteAtlas&) = delete;
+
+  // Find and check every page. Touches only this object's staging data,
+  // so it may run on a loader thread.
+  bool read();
+
+  // Hand the pages read() staged to `textures` (main thread), which must
+  // outlive the atlas. Sprites draw from then on.
+  void publish(TextureRegistry& textures);
+
+  // Sprite id by name (file name without extension), -1 if not in the atlas
+  int find(const char* name) const;
+
+  // Textured quad for sprite `id` covering `dst`; vertex order matches
+  // QUAD_INDICES. Returns nullptr (and leaves `out` alone) if unavailable.
+  SDL_Texture* quad(int id, const SDL_FRect& dst, SDL_Vertex out[4],
+                    SDL_Color tint = SDL_Color{ 255, 255, 255, 255 }) const;
+
+  static const int QUAD_INDICES[6];
+
+private:
+  struct Page {
+    int w = 0;
+    int h = 0;
+    TextureRegistry::Handle tex = 0;
+    AssetView file; // header + RGBA8 pixels, referenced by `tex`
+  };
+
+  void clear();
+
+  TextureRegistry*  m_textures = nullptr;
+  std::vector<Page> m_pages;  // published
+  std::vector<Page> m_staged; // read, not yet published
+};
@@ -0,0 +1,46 @@
+// src/SpscRing.h
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+
+// Lock-free single-producer / single-consumer ring buffer.
+// push() may only be called from one thread and pop() from one other thread.
+// N must be a power of two; one slot is never used so full != empty.
+template <typename T, std::size_t N>
+class SpscRing {
+  static_assert(N >= 2 && (N & (N - 1)) == 0, "SpscRing size must be a power of two");
+
+public:
+  bool push(const T& item) {
+    const std::size_t tail = m_tail.load(std::memory_order_relaxed);
+    const std::size_t next = (tail + 1) & (N - 1);
+    if (next == m_head.load(std::memory_order_acquire)) return false; // full
+
+    m_items[tail] = item;
+    m_tail.store(next, std::memory_order_release);
+    return true;
+  }
+
+  bool pop(T& out) {
+    const std::size_t head = m_head.load(std::memory_order_relaxed);
+    if (head == m_tail.load(std::memory_order_acquire)) return false; // empty
+
+    out = m_items[head];
+    m_head.store((head + 1) & (N - 1), std::memory_order_release);
+    return true;
+  }
+
+  bool full() const {
+    const std::size_t next = (m_tail.load(std::memory_order_relaxed) + 1) & (N - 1);
+    return next == m_head.load(std::memory_order_acquire);
+  }
+
+  static constexpr std::size_t capacity() { return N - 1; }
+
+private:
+  // Keep producer and consumer indices on separate cache lines
+  alignas(64) std::atomic<std::size_t> m_head{0}; // written by consumer
+  alignas(64) std::atomic<std::size_t> m_tail{0}; // written by producer
+  T m_items[N];
+};
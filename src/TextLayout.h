@@ -0,0 +1,42 @@
+// src/TextLayout.h
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+enum class TextAlign : uint8_t { Left, Center, Right };
+
+// How a string is laid out. `width` is the box lines are aligned in (and
+// wrapped / cut to); 0 means unbounded, with Center and Right aligning
+// around x = 0.
+struct TextStyle {
+  float     px = 16.f;       // line height in pixels
+  float     width = 0.f;
+  TextAlign align = TextAlign::Left;
+  bool      wrap = false;     // break at spaces (or anywhere, for long words)
+  bool      ellipsis = false; // end a cut-off last line with "..."
+  int       maxLines = 0;     // 0 = no limit
+
+  bool operator==(const TextStyle& o) const {
+    return px == o.px && width == o.width && align == o.align &&
+           wrap == o.wrap && ellipsis == o.ellipsis && maxLines == o.maxLines;
+  }
+};
+
+// Positioned glyphs of one string, relative to the top-left of its box.
+// Produced by SdfFont::layout() from cached metrics only.
+struct TextLayout {
+  struct Glyph {
+    uint16_t index = 0; // SdfFont glyph
+    float    x = 0.f;   // pen position
+    float    y = 0.f;   // top of the line
+  };
+
+  std::vector<Glyph> glyphs;
+  float px = 0.f;
+  float width = 0.f;  // widest line (ink included)
+  float advance = 0.f; // pen position after the last glyph (before alignment)
+  float height = 0.f; // lines * px
+  int   lines = 0;
+  bool  truncated = false;
+};
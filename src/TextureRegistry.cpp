@@ -0,0 +1,189 @@
+// src/TextureRegistry.cpp
+#include "TextureRegistry.h"
+
+#include <cstdio>
+#include <cstring>
+#include <utility>
+
+#include "SoftRaster.h"
+
+// Handle layout: generation in the high 16 bits, slot index + 1 in the low
+// 16, so a handle to a removed (and reused) slot is recognized as stale.
+static TextureRegistry::Handle makeHandle(uint32_t index, uint16_t generation) {
+  return ((uint32_t)generation << 16) | (index + 1);
+}
+
+TextureRegistry::~TextureRegistry() {
+  for (Entry& e : m_entries) release(e);
+}
+
+void TextureRegistry::setRenderer(SDL_Renderer* r, SoftRaster* soft) {
+  // Old textures died with the old renderer; just forget them
+  for (Entry& e : m_entries) {
+    e.tex = nullptr;
+    e.failed = false;
+  }
+  m_renderer = r;
+  m_soft = soft;
+}
+
+void TextureRegistry::invalidate() {
+  for (Entry& e : m_entries) {
+    release(e);
+    e.failed = false;
+  }
+}
+
+TextureRegistry::Handle TextureRegistry::insert(Entry&& e) {
+  uint32_t index;
+  if (!m_free.empty()) {
+    index = m_free.back();
+    m_free.pop_back();
+  } else {
+    if (m_entries.size() >= 0xFFFF) {
+      std::printf("TextureRegistry: out of handles\n");
+      return 0;
+    }
+    index = (uint32_t)m_entries.size();
+    m_entries.emplace_back();
+  }
+
+  Entry& slot = m_entries[index];
+  e.generation = slot.generation;
+  e.used = true;
+  slot = std::move(e);
+  return makeHandle(index, slot.generation);
+}
+
+TextureRegistry::Handle TextureRegistry::add(std::vector<uint8_t> pixels, int w, int h,
+                                             Uint32 format, SDL_BlendMode blend) {
+  if (w <= 0 || h <= 0 || pixels.size() < (size_t)w * h * 4) return 0;
+  if (format != SDL_PIXELFORMAT_ARGB8888 && format != SDL_PIXELFORMAT_RGBA32) {
+    std::printf("TextureRegistry: unsupported pixel format %u\n", (unsigned)format);
+    return 0;
+  }
+
+  Entry e;
+  e.w = w;
+  e.h = h;
+  e.format = format;
+  e.blend = blend;
+  e.pixels = std::move(pixels);
+  return insert(std::move(e));
+}
+
+TextureRegistry::Handle TextureRegistry::addExternal(const void* pixels, int w, int h,
+                                                     Uint32 format, SDL_BlendMode blend) {
+  if (!pixels || w <= 0 || h <= 0) return 0;
+  if (format != SDL_PIXELFORMAT_ARGB8888 && format != SDL_PIXELFORMAT_RGBA32) {
+    std::printf("TextureRegistry: unsupported pixel format %u\n", (unsigned)format);
+    return 0;
+  }
+
+  Entry e;
+  e.w = w;
+  e.h = h;
+  e.format = format;
+  e.blend = blend;
+  e.external = pixels;
+  return insert(std::move(e));
+}
+
+TextureRegistry::Handle TextureRegistry::add(SDL_Surface* surface, SDL_BlendMode blend) {
+  if (!surface) return 0;
+
+  SDL_Surface* argb = SDL_ConvertSurfaceFormat(surface, SDL_PIXELFORMAT_ARGB8888, 0);
+  if (!argb) {
+    std::printf("TextureRegistry: SDL_ConvertSurfaceFormat failed: %s\n", SDL_GetError());
+    return 0;
+  }
+
+  std::vector<uint8_t> pixels((size_t)argb->w * argb->h * 4);
+  const size_t row = (size_t)argb->w * 4;
+  SDL_LockSurface(argb);
+  for (int y = 0; y < argb->h; y++) {
+    std::memcpy(pixels.data() + y * row, (const uint8_t*)argb->pixels + (size_t)y * argb->pitch, row);
+  }
+  SDL_UnlockSurface(argb);
+
+  const int w = argb->w, h = argb->h;
+  SDL_FreeSurface(argb);
+  return add(std::move(pixels), w, h, SDL_PIXELFORMAT_ARGB8888, blend);
+}
+
+TextureRegistry::Handle TextureRegistry::add(int w, int h, Generator gen, SDL_BlendMode blend) {
+  if (w <= 0 || h <= 0 || !gen) return 0;
+
+  Entry e;
+  e.w = w;
+  e.h = h;
+  e.blend = blend;
+  e.gen = std::move(gen);
+  return insert(std::move(e));
+}
+
+TextureRegistry::Entry* TextureRegistry::find(Handle h) {
+  const uint32_t index = (h & 0xFFFF);
+  if (index == 0 || index > m_entries.size()) return nullptr;
+  Entry& e = m_entries[index - 1];
+  return (e.used && e.generation == (uint16_t)(h >> 16)) ? &e : nullptr;
+}
+
+const TextureRegistry::Entry* TextureRegistry::find(Handle h) const {
+  return const_cast<TextureRegistry*>(this)->find(h);
+}
+
+void TextureRegistry::remove(Handle h) {
+  Entry* e = find(h);
+  if (!e) return;
+
+  release(*e);
+  const uint16_t next = (uint16_t)(e->generation + 1);
+  *e = Entry{};
+  e->generation = next;
+  m_free.push_back((h & 0xFFFF) - 1);
+}
+
+void TextureRegistry::release(Entry& e) {
+  if (!e.tex) return;
+  if (m_soft) m_soft->forgetTexture(e.tex);
+  SDL_DestroyTexture(e.tex);
+  e.tex = nullptr;
+}
+
+SDL_Texture* TextureRegistry::get(Handle h) {
+  Entry* e = find(h);
+  if (!e) return nullptr;
+  if (!e->tex && (e->failed || !upload(*e))) return nullptr;
+  return e->tex;
+}
+
+bool TextureRegistry::size(Handle id, int& w, int& h) const {
+  const Entry* e = find(id);
+  if (!e) return false;
+  w = e->w;
+  h = e->h;
+  return true;
+}
+
+bool TextureRegistry::upload(Entry& e) {
+  if (!m_renderer) return false;
+
+  const void* pixels = e.external ? e.external : e.pixels.data();
+  if (e.gen) {
+    m_scratch.assign((size_t)e.w * e.h, 0u);
+    e.gen(m_scratch.data(), e.w, e.h);
+    pixels = m_scratch.data();
+  }
+
+  e.tex = SDL_CreateTexture(m_renderer, e.format, SDL_TEXTUREACCESS_STATIC, e.w, e.h);
+  if (!e.tex) {
+    std::printf("TextureRegistry: SDL_CreateTexture failed: %s\n", SDL_GetError());
+    e.failed = true;
+    return false;
+  }
+  SDL_UpdateTexture(e.tex, nullptr, pixels, e.w * 4);
+  SDL_SetTextureBlendMode(e.tex, e.blend);
+  if (m_soft) m_soft->setTexturePixels(e.tex, pixels, e.w, e.h, e.format);
+  return true;
+}
@@ -0,0 +1,90 @@
+// src/TextureRegistry.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <functional>
+#include <vector>
+
+class SoftRaster;
+
+// Static textures whose handles outlive the renderer.
+//
+// Game::applyDisplayChanges recreates the SDL_Renderer, which frees every
+// texture made from it. The registry keeps each texture's source (a pixel
+// copy or a generator callback) and uploads it again on the first get()
+// after a rebuild or device reset, so scenes can cache handles instead of
+// raw SDL_Texture pointers. Pixels are also handed to the CPU rasterizer.
+//
+// Render targets don't belong here: their contents can't be regenerated
+// from a source (see RaceScene's road tiles).
+class TextureRegistry {
+public:
+  // 0 is never a valid handle
+  using Handle = uint32_t;
+
+  // Fills w * h ARGB8888 pixels (straight alpha), rows tightly packed
+  using Generator = std::function<void(uint32_t* argb, int w, int h)>;
+
+  TextureRegistry() = default;
+  ~TextureRegistry();
+
+  TextureRegistry(const TextureRegistry&) = delete;
+  TextureRegistry& operator=(const TextureRegistry&) = delete;
+
+  // The renderer was recreated: SDL already freed our textures
+  void setRenderer(SDL_Renderer* r, SoftRaster* soft);
+
+  // Textures may have lost their contents (SDL_RENDER_DEVICE_RESET)
+  void invalidate();
+
+  // Keeps a copy of `pixels` (SDL_PIXELFORMAT_ARGB8888 or RGBA32, pitch w * 4)
+  Handle add(std::vector<uint8_t> pixels, int w, int h, Uint32 format,
+             SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+  // Same, without a copy: `pixels` must stay valid until remove(h) (e.g.
+  // assets embedded in the executable)
+  Handle addExternal(const void* pixels, int w, int h, Uint32 format,
+                     SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+  // Keeps a copy of the surface's pixels (converted to ARGB8888)
+  Handle add(SDL_Surface* surface, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+  // Keeps only the callback; it runs again on every re-upload
+  Handle add(int w, int h, Generator gen, SDL_BlendMode blend = SDL_BLENDMODE_BLEND);
+
+  void remove(Handle h);
+
+  // The texture for `h`, uploading it first if needed; nullptr if `h` is
+  // stale or the upload failed.
+  SDL_Texture* get(Handle h);
+
+  bool size(Handle id, int& w, int& h) const;
+
+private:
+  struct Entry {
+    SDL_Texture*         tex = nullptr;
+    int                  w = 0;
+    int                  h = 0;
+    Uint32               format = SDL_PIXELFORMAT_ARGB8888;
+    SDL_BlendMode        blend = SDL_BLENDMODE_BLEND;
+    std::vector<uint8_t> pixels; // empty for generated and external textures
+    const void*          external = nullptr;
+    Generator            gen;
+    uint16_t             generation = 0;
+    bool                 used = false;
+    bool                 failed = false; // don't retry until the next reset
+  };
+
+  Handle insert(Entry&& e);
+  Entry* find(Handle h);
+  const Entry* find(Handle h) const;
+  bool   upload(Entry& e);
+  void   release(Entry& e);
+
+  SDL_Renderer*         m_renderer = nullptr;
+  SoftRaster*           m_soft = nullptr;
+  std::vector<Entry>    m_entries;
+  std::vector<uint32_t> m_free;
+  std::vector<uint32_t> m_scratch; // generator output
+};
@@ -0,0 +1,66 @@
+// src/TrafficBench.cpp
+#include "TrafficBench.h"
+
+#include <SDL2/SDL.h>
+#include <algorithm>
+#include <cstdio>
+#include <vector>
+
+#include "TrafficSim.h"
+
+namespace {
+
+const int    LANES = 8;
+const int    WARMUP_TICKS = 120; // lets lane changes and recycling settle
+const int    TICKS = 3000;
+const float  DT = 1.f / 60.f;
+const float  CAMERA_SPEED = 700.f; // px/s, a mid-level race speed
+const float  CAR_SPACING = 320.f;  // px between cars of one lane at reset
+const double BUDGET_MS = 1.0;
+
+} // namespace
+
+int runTrafficBench(int cars) {
+  cars = std::max(1, cars);
+
+  // The window grows with the population so density stays race-like
+  TrafficSim::Params p;
+  p.lanes = LANES;
+  p.count = cars;
+  p.minSpeed = 300.f;
+  p.maxSpeed = 900.f;
+  p.behind = 1400.f;
+  p.ahead = std::max(3600.f, (float)((cars + LANES - 1) / LANES) * CAR_SPACING);
+  p.seed = 12345;
+
+  TrafficSim sim;
+  double camera = 0.0;
+  sim.reset(p, camera);
+
+  const double toMs = 1000.0 / (double)SDL_GetPerformanceFrequency();
+  std::vector<double> samples;
+  samples.reserve(TICKS);
+  double totalMs = 0.0;
+
+  for (int t = 0; t < WARMUP_TICKS + TICKS; t++) {
+    camera += CAMERA_SPEED * DT;
+
+    const Uint64 start = SDL_GetPerformanceCounter();
+    sim.addBlocker(TrafficSim::Blocker{ camera + 300.0, 90.f, CAMERA_SPEED, LANES / 2 });
+    sim.update(DT, camera);
+    const double ms = (double)(SDL_GetPerformanceCounter() - start) * toMs;
+
+    if (t < WARMUP_TICKS) continue;
+    totalMs += ms;
+    samples.push_back(ms);
+  }
+
+  // The slowest 1% is mostly the OS preempting us; judge by the 99th percentile
+  auto p99 = samples.begin() + (samples.size() * 99) / 100;
+  std::nth_element(samples.begin(), p99, samples.end());
+  const double worstMs = *std::max_element(p99, samples.end());
+
+  std::printf("bench: traffic %d cars, %d lanes, %d ticks: %.3f ms/tick mean, %.3f ms p99, %.3f ms worst (budget %.1f ms)\n",
+    cars, LANES, TICKS, totalMs / TICKS, *p99, worstMs, BUDGET_MS);
+  return *p99 <= BUDGET_MS ? 0 : 1;
+}
@@ -0,0 +1,11 @@
+// src/TrafficBench.h
+#pragma once
+
+// Headless TrafficSim benchmark (`game --bench-traffic [cars]`).
+//
+// Simulates `cars` AI cars (1000 by default) on 8 lanes with the
+// camera moving at race speed and the player fed in as a blocker, like
+// RaceScene does, for a fixed number of 60 Hz ticks at a fixed seed. Prints
+// the mean, 99th percentile and worst milliseconds per tick; returns 0 when
+// the 99th percentile stays within the 1 ms per tick budget.
+int runTrafficBench(int cars);
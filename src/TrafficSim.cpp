@@ -0,0 +1,303 @@
+// src/TrafficSim.cpp
+#include "TrafficSim.h"
+
+#include <algorithm>
+#include <cmath>
+
+namespace {
+
+// IDM / lane change tunables (px, px/s, px/s^2)
+constexpr float IDM_ACCEL      = 320.f; // max acceleration
+constexpr float IDM_DECEL      = 650.f; // comfortable braking
+constexpr float IDM_HEADWAY    = 0.6f;  // desired time gap (s)
+constexpr float IDM_MIN_GAP    = 24.f;  // jam distance
+constexpr float MAX_BRAKE      = 3000.f;
+constexpr float SAFE_BRAKE     = 900.f; // new follower must not need more than this
+constexpr float CHANGE_GAIN    = 80.f;  // accel advantage needed to change lane
+constexpr float CHANGE_RATE    = 2.5f;  // lanes per second while changing
+constexpr float CHANGE_COOLDOWN = 1.5f;
+
+} // namespace
+
+void TrafficSim::reset(const Params& p, double camera) {
+  m_params = p;
+  m_params.lanes = std::max(1, p.lanes);
+  m_params.count = std::max(0, p.count);
+  m_rng.seed(p.seed);
+
+  m_cars.assign((size_t)m_params.count, Car{});
+  m_accel.assign(m_cars.size(), 0.f);
+  m_blockers.clear();
+  m_maxLength = m_params.carLength;
+
+  // Spread cars evenly over the window ahead of the screen, lane by lane
+  const int lanes = m_params.lanes;
+  const int perLane = (m_params.count + lanes - 1) / std::max(1, lanes);
+  const double start = camera + 200.0;
+  const double spacing = (m_params.ahead - 200.0) / std::max(1, perLane);
+
+  std::uniform_real_distribution<float> speed(m_params.minSpeed, m_params.maxSpeed);
+  std::uniform_real_distribution<float> jitter(-0.15f, 0.15f);
+
+  for (int i = 0; i < m_params.count; i++) {
+    Car& c = m_cars[i];
+    c.lane = i % lanes;
+    c.laneF = (float)c.lane;
+    c.y = start + ((double)(i / lanes) + 0.5 + jitter(m_rng)) * spacing;
+    c.v0 = speed(m_rng);
+    c.v = c.v0;
+    c.cooldown = 0.f;
+  }
+
+  rebuildHash(camera);
+}
+
+int TrafficSim::cellOf(double y) const {
+  int c = (int)std::floor((y - m_windowStart) / CELL);
+  return std::max(0, std::min(c, m_cells - 1));
+}
+
+double TrafficSim::itemY(int id) const {
+  const int n = (int)m_cars.size();
+  return id < n ? m_cars[id].y : m_blockers[id - n].y;
+}
+
+float TrafficSim::itemLength(int id) const {
+  const int n = (int)m_cars.size();
+  return id < n ? m_params.carLength : m_blockers[id - n].length;
+}
+
+float TrafficSim::itemV(int id) const {
+  const int n = (int)m_cars.size();
+  return id < n ? m_cars[id].v : m_blockers[id - n].v;
+}
+
+void TrafficSim::rebuildHash(double camera) {
+  // One cell of padding each side; anything outside is clamped to the ends
+  m_windowStart = camera - m_params.behind - CELL;
+  m_cells = (int)std::ceil((m_params.behind + m_params.ahead) / CELL) + 3;
+
+  const int lanes = m_params.lanes;
+  const int slots = lanes * m_cells;
+  const int carCount = (int)m_cars.size();
+  const int items = carCount + (int)m_blockers.size();
+
+  m_cellStart.assign((size_t)slots + 1, 0);
+  m_itemCell.resize((size_t)items);
+  m_cellItems.resize((size_t)items);
+
+  // Counting sort by (lane, cell)
+  for (int id = 0; id < items; id++) {
+    int lane = id < carCount ? m_cars[id].lane : m_blockers[id - carCount].lane;
+    if (lane < 0 || lane >= lanes) { m_itemCell[id] = -1; continue; }
+    int slot = lane * m_cells + cellOf(itemY(id));
+    m_itemCell[id] = slot;
+    m_cellStart[slot + 1]++;
+  }
+  for (int s = 0; s < slots; s++) m_cellStart[s + 1] += m_cellStart[s];
+
+  m_cellCursor.assign(m_cellStart.begin(), m_cellStart.end() - 1);
+  int placed = 0;
+  for (int id = 0; id < items; id++) {
+    int slot = m_itemCell[id];
+    if (slot < 0) continue;
+    m_cellItems[m_cellCursor[slot]++] = id;
+    placed++;
+  }
+  m_cellItems.resize((size_t)placed);
+}
+
+TrafficSim::Neighbor TrafficSim::leader(int lane, double front) const {
+  Neighbor best;
+  if (lane < 0 || lane >= m_params.lanes) return best;
+
+  const int c0 = cellOf(front);
+  const int c1 = cellOf(front + LOOKAHEAD);
+  for (int c = c0; c <= c1; c++) {
+    // Nothing in this or later cells can beat the best gap found so far
+    double cellStart = m_windowStart + (double)c * CELL;
+    if (best.found && cellStart > front + best.gap + m_maxLength) break;
+
+    const int slot = lane * m_cells + c;
+    for (int i = m_cellStart[slot]; i < m_cellStart[slot + 1]; i++) {
+      const int id = m_cellItems[i];
+      const double y = itemY(id);
+      if (y <= front) continue;
+
+      // Overlapping items (gap < 0) are ignored rather than causing a jam
+      const double gap = (y - itemLength(id)) - front;
+      if (gap < 0.0) continue;
+      if (!best.found || gap < best.gap) {
+        best.found = true;
+        best.gap = gap;
+        best.v = itemV(id);
+      }
+    }
+  }
+  return best;
+}
+
+TrafficSim::Neighbor TrafficSim::follower(int lane, double rear) const {
+  Neighbor best;
+  if (lane < 0 || lane >= m_params.lanes) return best;
+
+  const int c0 = cellOf(rear);
+  const int c1 = cellOf(rear - LOOKAHEAD);
+  for (int c = c0; c >= c1; c--) {
+    double cellEnd = m_windowStart + (double)(c + 1) * CELL;
+    if (best.found && cellEnd < rear - best.gap) break;
+
+    const int slot = lane * m_cells + c;
+    for (int i = m_cellStart[slot]; i < m_cellStart[slot + 1]; i++) {
+      const int id = m_cellItems[i];
+      const double gap = rear - itemY(id);
+      if (gap < 0.0) continue;
+      if (!best.found || gap < best.gap) {
+        best.found = true;
+        best.gap = gap;
+        best.v = itemV(id);
+      }
+    }
+  }
+  return best;
+}
+
+float TrafficSim::idmAccel(const Car& c, const Neighbor& lead) const {
+  const float ratio = c.v / std::max(1.f, c.v0);
+  float a = 1.f - ratio * ratio * ratio * ratio;
+
+  if (lead.found) {
+    const float dv = c.v - lead.v;
+    const float sStar = IDM_MIN_GAP + std::max(0.f,
+      c.v * IDM_HEADWAY + c.v * dv / (2.f * std::sqrt(IDM_ACCEL * IDM_DECEL)));
+    const float s = std::max(1.f, (float)lead.gap);
+    a -= (sStar / s) * (sStar / s);
+  }
+
+  return std::max(-MAX_BRAKE, IDM_ACCEL * a);
+}
+
+bool TrafficSim::occupied(int lane, double front, double rear) const {
+  if (lane < 0 || lane >= m_params.lanes) return true;
+
+  const int c0 = cellOf(rear);
+  const int c1 = cellOf(front + m_maxLength);
+  for (int c = c0; c <= c1; c++) {
+    const int slot = lane * m_cells + c;
+    for (int i = m_cellStart[slot]; i < m_cellStart[slot + 1]; i++) {
+      const int id = m_cellItems[i];
+      const double y = itemY(id);
+      if (y > rear && y - itemLength(id) < front) return true;
+    }
+  }
+  return false;
+}
+
+bool TrafficSim::canChangeInto(const Car& c, int lane, float& accel) const {
+  const float len = m_params.carLength;
+  if (occupied(lane, c.y + IDM_MIN_GAP, c.y - len - IDM_MIN_GAP)) return false;
+
+  Neighbor lead = leader(lane, c.y);
+  Neighbor back = follower(lane, c.y - len);
+  if (back.found) {
+    // Would the new follower have to brake too hard for us?
+    const float closing = std::max(0.f, back.v - c.v);
+    if (closing * closing / (2.f * (float)back.gap) > SAFE_BRAKE) return false;
+  }
+
+  accel = idmAccel(c, lead);
+  return true;
+}
+
+void TrafficSim::recycle(Car& c, double camera) {
+  const double len = m_params.carLength;
+  const double windowLo = camera - m_params.behind;
+  const double windowHi = camera + m_params.ahead;
+
+  double y = 0.0;
+  if (c.y < windowLo) {
+    // Overtaken by the player: reappear far ahead
+    y = windowHi - std::uniform_real_distribution<double>(0.0, 600.0)(m_rng);
+  } else if (c.y - len > windowHi + CELL) {
+    // Ran away from a stopped player: come back from behind
+    y = windowLo + std::uniform_real_distribution<double>(0.0, 300.0)(m_rng);
+  } else {
+    return;
+  }
+
+  // First lane (from a random start) with room; otherwise retry next tick
+  const int lanes = m_params.lanes;
+  const int first = std::uniform_int_distribution<int>(0, lanes - 1)(m_rng);
+  for (int k = 0; k < lanes; k++) {
+    const int lane = (first + k) % lanes;
+    if (m_laneRecycled[lane]) continue;
+    if (occupied(lane, y + 2.0 * len, y - 3.0 * len)) continue;
+    Neighbor ahead = leader(lane, y);
+    m_laneRecycled[lane] = 1;
+
+    c.y = y;
+    c.lane = lane;
+    c.laneF = (float)lane;
+    c.v = ahead.found ? std::min(c.v0, ahead.v) : c.v0;
+    c.cooldown = CHANGE_COOLDOWN;
+    return;
+  }
+}
+
+void TrafficSim::update(float dt, double camera) {
+  if (m_cars.empty()) {
+    m_blockers.clear(); // consumed even when there is no one to block
+    return;
+  }
+
+  m_maxLength = m_params.carLength;
+  for (const auto& b : m_blockers) m_maxLength = std::max(m_maxLength, b.length);
+
+  rebuildHash(camera);
+
+  const int n = (int)m_cars.size();
+  const int lanes = m_params.lanes;
+
+  // Lane changes alternate direction by tick, so two cars can never merge
+  // into the same gap from both sides on the same tick.
+  const int changeDir = (m_tick++ & 1u) ? 1 : -1;
+
+  // 1) Decide: car-following acceleration + lane changes, all against the
+  //    hash built above (decisions within a tick don't see each other).
+  for (int i = 0; i < n; i++) {
+    Car& c = m_cars[i];
+    float a = idmAccel(c, leader(c.lane, c.y));
+
+    c.cooldown -= dt;
+    const bool settled = std::fabs(c.laneF - (float)c.lane) < 0.01f;
+    if (lanes > 1 && c.cooldown <= 0.f && settled && a < IDM_ACCEL * 0.5f) {
+      const int lane = c.lane + changeDir;
+      float na = 0.f;
+      if (canChangeInto(c, lane, na) && na > a + CHANGE_GAIN) {
+        c.lane = lane;
+        c.cooldown = CHANGE_COOLDOWN;
+        a = na;
+      }
+    }
+
+    m_accel[i] = a;
+  }
+
+  // 2) Integrate
+  for (int i = 0; i < n; i++) {
+    Car& c = m_cars[i];
+    c.v = std::max(0.f, c.v + m_accel[i] * dt);
+    c.y += (double)(c.v * dt);
+
+    const float target = (float)c.lane;
+    const float step = CHANGE_RATE * dt;
+    if (c.laneF < target) c.laneF = std::min(target, c.laneF + step);
+    else if (c.laneF > target) c.laneF = std::max(target, c.laneF - step);
+  }
+
+  // 3) Keep the population inside the simulated window
+  m_laneRecycled.assign((size_t)lanes, 0);
+  for (auto& c : m_cars) recycle(c, camera);
+
+  m_blockers.clear();
+}
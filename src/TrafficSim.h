@@ -0,0 +1,129 @@
+// src/TrafficSim.h
+#pragma once
+
+#include <cstdint>
+#include <random>
+#include <vector>
+
+// AI traffic microsimulation.
+//
+// Cars follow the Intelligent Driver Model (IDM) along their lane and change
+// lanes with a simplified MOBIL rule (go if it clearly helps and the new
+// follower can brake safely). Neighbor lookups go through a per-lane spatial
+// hash of fixed-size world cells that is rebuilt with a counting sort every
+// tick, so the whole step is O(cars) with O(1) neighbor queries.
+//
+// Coordinates match RaceScene: y is world distance, larger is further ahead;
+// a car's y is its front bumper and it extends `carLength` behind that.
+// Only a window around the camera is simulated; cars leaving it are recycled
+// to the far end, so the population (and memory) is fixed.
+class TrafficSim {
+public:
+  struct Params {
+    int      lanes = 3;
+    int      count = 0;
+    float    minSpeed = 300.f;  // desired speed range (px/s)
+    float    maxSpeed = 600.f;
+    float    carLength = 80.f;
+    float    behind = 1200.f;   // simulated window below the camera (px)
+    float    ahead = 3600.f;    // ... and above it
+    uint32_t seed = 0;
+  };
+
+  struct Car {
+    double y = 0.0;       // front bumper (world)
+    float  v = 0.f;       // current speed (px/s)
+    float  v0 = 0.f;      // desired speed
+    float  laneF = 0.f;   // lateral position in lanes; eases towards `lane`
+    int    lane = 0;      // lane the car drives in (target lane while changing)
+    float  cooldown = 0.f;
+  };
+
+  // Something AI cars must not drive into (static obstacles, the player).
+  struct Blocker {
+    double y;             // front edge (world)
+    float  length;
+    float  v;
+    int    lane;
+  };
+
+  void reset(const Params& p, double camera);
+
+  // Blockers are consumed by the next update(); refill them every tick.
+  void addBlocker(const Blocker& b) { m_blockers.push_back(b); }
+
+  void update(float dt, double camera);
+
+  const std::vector<Car>& cars() const { return m_cars; }
+  float carLength() const { return m_params.carLength; }
+
+  // Calls fn(const Car&) for every car overlapping world range [y0, y1].
+  // Uses the hash from the last update(), padded by one cell for movement.
+  template <typename Fn>
+  void forEachInRange(double y0, double y1, Fn&& fn) const {
+    if (m_cars.empty() || m_cellStart.empty()) return;
+    int c0 = cellOf(y0) - 1;
+    int c1 = cellOf(y1 + m_params.carLength) + 1;
+    c0 = c0 < 0 ? 0 : c0;
+    c1 = c1 >= m_cells ? m_cells - 1 : c1;
+    const int carCount = (int)m_cars.size();
+    for (int lane = 0; lane < m_params.lanes; lane++) {
+      for (int c = c0; c <= c1; c++) {
+        const int slot = lane * m_cells + c;
+        for (int i = m_cellStart[slot]; i < m_cellStart[slot + 1]; i++) {
+          const int id = m_cellItems[i];
+          if (id >= carCount) continue; // blocker
+          const Car& car = m_cars[id];
+          if (car.y >= y0 && car.y - m_params.carLength <= y1) fn(car);
+        }
+      }
+    }
+  }
+
+private:
+  static constexpr float CELL = 128.f;    // hash cell length (world px)
+  static constexpr float LOOKAHEAD = 600.f; // beyond this the road counts as free
+
+  // Neighbor found through the hash
+  struct Neighbor {
+    bool   found = false;
+    double gap = 0.0;     // bumper-to-bumper distance
+    float  v = 0.f;
+  };
+
+  int cellOf(double y) const;
+  void rebuildHash(double camera);
+
+  double itemY(int id) const;
+  float  itemLength(int id) const;
+  float  itemV(int id) const;
+
+  Neighbor leader(int lane, double front) const;
+  Neighbor follower(int lane, double rear) const;
+  bool occupied(int lane, double front, double rear) const; // anything alongside?
+
+  float idmAccel(const Car& c, const Neighbor& lead) const;
+  // Safe to move c into `lane`? If so, accel is its IDM acceleration there.
+  bool  canChangeInto(const Car& c, int lane, float& accel) const;
+  void  recycle(Car& c, double camera);
+
+  Params m_params{};
+  std::vector<Car>     m_cars;
+  std::vector<Blocker> m_blockers;
+  std::vector<float>   m_accel;
+
+  // Spatial hash: per lane, cells of CELL px from m_windowStart;
+  // m_cellItems[m_cellStart[lane * m_cells + c] .. next) are item ids
+  // (cars first, then blockers at m_cars.size() + i).
+  double           m_windowStart = 0.0;
+  int              m_cells = 0;
+  std::vector<int> m_cellStart;
+  std::vector<int> m_cellItems;
+  std::vector<int> m_itemCell;
+  std::vector<int> m_cellCursor;
+  std::vector<char> m_laneRecycled; // one recycle per lane per tick (hash is stale)
+  unsigned m_tick = 0;
+  float            m_maxLength = 0.f; // longest hashed item, bounds leader scans
+
+  std::mt19937 m_rng;
+};
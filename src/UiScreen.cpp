@@ -0,0 +1,406 @@
+// src/UiScreen.cpp
+#include "UiScreen.h"
+
+#include <algorithm>
+#include <cmath>
+#include <utility>
+
+static bool sameColor(SDL_Color a, SDL_Color b) {
+  return a.r == b.r && a.g == b.g && a.b == b.b && a.a == b.a;
+}
+
+// Straight-alpha `src` over opaque `dst`: untextured geometry draws
+// without blending, so translucent outlines are resolved up front
+static SDL_Color over(SDL_Color dst, SDL_Color src) {
+  const int a = src.a, ia = 255 - a;
+  return SDL_Color{ (Uint8)((src.r * a + dst.r * ia + 127) / 255),
+                    (Uint8)((src.g * a + dst.g * ia + 127) / 255),
+                    (Uint8)((src.b * a + dst.b * ia + 127) / 255), 255 };
+}
+
+// The same for one ARGB8888 pixel of a baked texture, whose destination may
+// itself be translucent
+static uint32_t overPixel(uint32_t dst, SDL_Color src) {
+  const int sa = src.a;
+  const int da = (int)(dst >> 24) * (255 - sa) / 255;
+  const int oa = sa + da;
+  if (oa == 0) return 0;
+  auto mix = [&](int shift, int s) {
+    return (uint32_t)((s * sa + (int)((dst >> shift) & 0xFF) * da + oa / 2) / oa) << shift;
+  };
+  return ((uint32_t)oa << 24) | mix(16, src.r) | mix(8, src.g) | mix(0, src.b);
+}
+
+static SDL_Rect enclosing(const SDL_FRect& f) {
+  int left = (int)std::floor(f.x), top = (int)std::floor(f.y);
+  int right = (int)std::ceil(f.x + f.w), bottom = (int)std::ceil(f.y + f.h);
+  return SDL_Rect{ left, top, right - left, bottom - top };
+}
+
+UiScreen::~UiScreen() {
+  releaseTextures();
+}
+
+UiScreen::Id UiScreen::add(Id parent, Widget&& w) {
+  const Id id = (Id)m_widgets.size();
+  w.parent = parent;
+  m_widgets.push_back(std::move(w));
+  if (parent >= 0) m_widgets[(size_t)parent].children.push_back(id);
+  m_layoutDirty = true;
+  return id;
+}
+
+UiScreen::Id UiScreen::panel(Id parent, float w, float h, const Box& box, float padding, float gap) {
+  Widget p;
+  p.kind = Kind::Panel;
+  p.w = w;
+  p.h = h;
+  p.box = box;
+  p.padding = padding;
+  p.gap = gap;
+  return add(parent, std::move(p));
+}
+
+UiScreen::Id UiScreen::label(Id parent, const char* text, float px, SDL_Color color, float h) {
+  Widget l;
+  l.kind = Kind::Label;
+  l.text = text;
+  l.px = px;
+  l.color = color;
+  l.h = h;
+  return add(parent, std::move(l));
+}
+
+UiScreen::Id UiScreen::list(Id parent, const ListStyle& style) {
+  Widget l;
+  l.kind = Kind::List;
+  l.gap = style.gap;
+  l.list = style;
+  return add(parent, std::move(l));
+}
+
+UiScreen::Id UiScreen::button(Id parent, const char* text, float w, float h, float px,
+                              SDL_Color color, const Box& box) {
+  Widget b;
+  b.kind = Kind::Button;
+  b.text = text;
+  b.w = w;
+  b.h = h;
+  b.px = px;
+  b.color = color;
+  b.box = box;
+  return add(parent, std::move(b));
+}
+
+void UiScreen::setText(Id id, const char* text) {
+  Widget& w = m_widgets[(size_t)id];
+  if (w.text == text) return;
+  w.text = text;
+  m_layoutDirty = true;
+}
+
+void UiScreen::select(Id list, int index) {
+  Widget& l = m_widgets[(size_t)list];
+  const int count = (int)l.children.size();
+  if (count == 0) return;
+  index = std::max(0, std::min(index, count - 1));
+  if (index == l.selected) return;
+
+  damageWidget(l.children[(size_t)l.selected]);
+  l.selected = index;
+  damageWidget(l.children[(size_t)l.selected]);
+}
+
+void UiScreen::move(Id list, int delta) {
+  const int count = (int)m_widgets[(size_t)list].children.size();
+  if (count == 0) return;
+  select(list, ((selected(list) + delta) % count + count) % count);
+}
+
+int UiScreen::selected(Id list) const {
+  return m_widgets[(size_t)list].selected;
+}
+
+void UiScreen::setHighlightMod(Id list, SDL_Color mod) {
+  Widget& l = m_widgets[(size_t)list];
+  if (sameColor(l.mod, mod)) return;
+  l.mod = mod;
+  if (!l.children.empty()) damageWidget(l.children[(size_t)l.selected]);
+}
+
+void UiScreen::resize(int w, int h, float scale) {
+  const bool fontReady = m_font->ready();
+  if (w == m_w && h == m_h && scale == m_scale && fontReady == m_fontReady) return;
+  m_w = w;
+  m_h = h;
+  m_scale = scale;
+  m_fontReady = fontReady;
+  m_layoutDirty = true;
+}
+
+SDL_Rect UiScreen::bounds(Id id) const {
+  return enclosing(m_widgets[(size_t)id].rect);
+}
+
+void UiScreen::damageWidget(Id id) {
+  if (!m_layoutDirty) m_damage.push_back(bounds(id));
+}
+
+void UiScreen::damage(std::vector<SDL_Rect>& rects) const {
+  if (m_layoutDirty || m_damageAll) {
+    rects.push_back(SDL_Rect{ 0, 0, m_w, m_h });
+    return;
+  }
+  rects.insert(rects.end(), m_damage.begin(), m_damage.end());
+}
+
+// Sizes only; place() positions afterwards
+void UiScreen::measure(Id id, float availW) {
+  Widget& w = m_widgets[(size_t)id];
+  const float s = m_scale;
+  w.rect.w = std::round(w.w > 0.f ? w.w * s : availW);
+  w.layout = TextLayout{};
+
+  switch (w.kind) {
+    case Kind::Label:
+    case Kind::Button: {
+      const float px = std::round(w.px * s);
+      const float pad = (w.kind == Kind::Button) ? std::round(8.f * s) : 0.f;
+      const float boxH = w.h > 0.f ? std::round(w.h * s) : 0.f;
+
+      TextStyle style;
+      style.px = px;
+      style.width = std::max(0.f, w.rect.w - 2.f * pad);
+      style.align = TextAlign::Center;
+      style.wrap = true;
+      style.ellipsis = true;
+      style.maxLines = (w.kind == Kind::Button) ? 1 : (boxH > 0.f ? std::max(1, (int)(boxH / px)) : 0);
+      if (m_font->ready() && px > 0.f) w.layout = m_font->layout(w.text.c_str(), style);
+
+      w.rect.h = boxH > 0.f ? boxH : std::max(w.layout.height, px);
+      break;
+    }
+
+    case Kind::Panel:
+    case Kind::List: {
+      const float pad = std::round(w.padding * s);
+      const float gap = std::round(w.gap * s);
+      float content = 0.f;
+      for (size_t i = 0; i < w.children.size(); i++) {
+        measure(w.children[i], w.rect.w - 2.f * pad);
+        content += m_widgets[(size_t)w.children[i]].rect.h + (i > 0 ? gap : 0.f);
+      }
+      w.rect.h = w.h > 0.f ? std::round(w.h * s) : content + 2.f * pad;
+      break;
+    }
+  }
+}
+
+void UiScreen::place(Id id, float x, float y) {
+  Widget& w = m_widgets[(size_t)id];
+  w.rect.x = x;
+  w.rect.y = y;
+
+  const float pad = std::round(w.padding * m_scale);
+  const float gap = std::round(w.gap * m_scale);
+  float cy = y + pad;
+  for (Id c : w.children) {
+    const Widget& child = m_widgets[(size_t)c];
+    place(c, x + std::round((w.rect.w - child.rect.w) * 0.5f), cy);
+    cy += child.rect.h + gap;
+  }
+}
+
+void UiScreen::layout() {
+  m_layoutDirty = false;
+  m_damageAll = true;
+  releaseTextures(); // sizes and labels may have changed
+  if (m_widgets.empty()) return;
+
+  measure(0, (float)m_w);
+  const Widget& root = m_widgets[0];
+  place(0, std::round((m_w - root.rect.w) * 0.5f), std::round((m_h - root.rect.h) * 0.5f));
+}
+
+void UiScreen::addRect(const SDL_FRect& r, SDL_Color c) {
+  if (r.w <= 0.f || r.h <= 0.f) return;
+
+  const int base = (int)m_shapeVerts.size();
+  m_shapeVerts.push_back(SDL_Vertex{ { r.x,       r.y },       c, { 0.f, 0.f } });
+  m_shapeVerts.push_back(SDL_Vertex{ { r.x + r.w, r.y },       c, { 0.f, 0.f } });
+  m_shapeVerts.push_back(SDL_Vertex{ { r.x,       r.y + r.h }, c, { 0.f, 0.f } });
+  m_shapeVerts.push_back(SDL_Vertex{ { r.x + r.w, r.y + r.h }, c, { 0.f, 0.f } });
+  const int quad[6] = { base, base + 1, base + 2, base + 1, base + 3, base + 2 };
+  m_shapeIndices.insert(m_shapeIndices.end(), quad, quad + 6);
+}
+
+// One line thick (scaled), inside `r` like SDL_RenderDrawRect
+void UiScreen::addOutline(const SDL_FRect& r, SDL_Color c) {
+  const float t = std::max(1.f, std::round(m_scale));
+  addRect(SDL_FRect{ r.x, r.y, r.w, t }, c);
+  addRect(SDL_FRect{ r.x, r.y + r.h - t, r.w, t }, c);
+  addRect(SDL_FRect{ r.x, r.y + t, t, r.h - 2.f * t }, c);
+  addRect(SDL_FRect{ r.x + r.w - t, r.y + t, t, r.h - 2.f * t }, c);
+}
+
+void UiScreen::addBox(const SDL_FRect& r, const Box& box) {
+  if (box.fill.a) addRect(r, box.fill);
+  if (box.border.a) addOutline(r, box.border);
+  if (box.inset.a) {
+    const float in = std::round(box.insetBy * m_scale);
+    const SDL_FRect inner{ r.x + in, r.y + in, r.w - 2.f * in, r.h - 2.f * in };
+    addOutline(inner, box.fill.a ? over(box.fill, box.inset) : box.inset);
+  }
+}
+
+void UiScreen::addText(const Widget& w, float x, float y) {
+  if (w.layout.glyphs.empty()) return;
+
+  auto batch = std::find_if(m_text.begin(), m_text.end(),
+                            [&](const TextBatch& b) { return b.px == w.layout.px; });
+  if (batch == m_text.end()) {
+    m_text.emplace_back();
+    batch = m_text.end() - 1;
+    batch->px = w.layout.px;
+  }
+  m_font->append(w.layout, x, y, w.color, batch->verts, batch->indices);
+}
+
+UiScreen::Id UiScreen::listOf(Id button) const {
+  const Id parent = m_widgets[(size_t)button].parent;
+  if (parent < 0 || m_widgets[(size_t)parent].kind != Kind::List) return -1;
+  return parent;
+}
+
+// The box as addBox() records it, then the marker and the label, all in
+// the button's own pixels
+void UiScreen::bakeButton(Id id, bool selected, uint32_t* argb, int w, int h) const {
+  const Widget& b = m_widgets[(size_t)id];
+  const Id list = selected ? listOf(id) : -1;
+  const float s = m_scale;
+
+  auto fill = [&](float fx, float fy, float fw, float fh, SDL_Color c) {
+    if (!c.a) return;
+    const int x0 = std::max(0, (int)fx), y0 = std::max(0, (int)fy);
+    const int x1 = std::min(w, (int)(fx + fw)), y1 = std::min(h, (int)(fy + fh));
+    for (int y = y0; y < y1; y++) {
+      uint32_t* row = argb + (size_t)y * w;
+      for (int x = x0; x < x1; x++) row[x] = overPixel(row[x], c);
+    }
+  };
+  auto outline = [&](float x, float y, float ow, float oh, SDL_Color c) {
+    const float t = std::max(1.f, std::round(s));
+    fill(x, y, ow, t, c);
+    fill(x, y + oh - t, ow, t, c);
+    fill(x, y + t, t, oh - 2.f * t, c);
+    fill(x + ow - t, y + t, t, oh - 2.f * t, c);
+  };
+
+  const float bw = (float)w, bh = (float)h;
+  fill(0.f, 0.f, bw, bh, list >= 0 ? m_widgets[(size_t)list].list.highlight : b.box.fill);
+  outline(0.f, 0.f, bw, bh, b.box.border);
+  if (b.box.inset.a) {
+    const float in = std::round(b.box.insetBy * s);
+    outline(in, in, bw - 2.f * in, bh - 2.f * in, b.box.inset);
+  }
+  if (list >= 0) {
+    fill(std::round(10.f * s), std::round(bh * 0.5f - 6.f * s),
+         std::round(12.f * s), std::round(12.f * s), m_widgets[(size_t)list].list.marker);
+  }
+
+  const float pad = std::round(8.f * s);
+  m_font->paint(b.layout, pad, std::round((bh - b.layout.height) * 0.5f), b.color, argb, w, h);
+}
+
+void UiScreen::releaseTextures() {
+  for (Widget& w : m_widgets) {
+    for (TextureRegistry::Handle& t : w.tex) {
+      if (t) m_textures->remove(t);
+      t = 0;
+    }
+  }
+}
+
+void UiScreen::build() {
+  m_shapeVerts.clear();
+  m_shapeIndices.clear();
+  for (TextBatch& b : m_text) {
+    b.verts.clear();
+    b.indices.clear();
+  }
+
+  // Tree order: parents before children, so fills stack correctly in the
+  // single shape run. Buttons and text go on the layer above.
+  for (size_t i = 0; i < m_widgets.size(); i++) {
+    Widget& w = m_widgets[i];
+    const SDL_FRect& r = w.rect;
+
+    switch (w.kind) {
+      case Kind::Panel:
+        addBox(r, w.box);
+        break;
+
+      case Kind::Label:
+        addText(w, r.x, r.y + std::round((r.h - w.layout.height) * 0.5f));
+        break;
+
+      case Kind::List:
+        break;
+
+      case Kind::Button: {
+        // Baked on first use, and again from the widget after a renderer
+        // rebuild; layout() drops them when size or label change
+        const int tw = (int)r.w, th = (int)r.h;
+        if (tw <= 0 || th <= 0) break;
+        const Id id = (Id)i;
+        const Id list = listOf(id);
+        for (int state = 0; state < (list >= 0 ? 2 : 1); state++) {
+          const SDL_Color fill = state ? m_widgets[(size_t)list].list.highlight : w.box.fill;
+          const bool selected = state == 1;
+          w.tex[state] = m_textures->add(tw, th, [this, id, selected](uint32_t* argb, int bw, int bh) {
+            bakeButton(id, selected, argb, bw, bh);
+          }, fill.a == 255 ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+        }
+        break;
+      }
+    }
+  }
+}
+
+void UiScreen::render(RenderQueue& q, uint8_t layer) {
+  if (m_layoutDirty) {
+    layout();
+    build();
+  }
+  m_damage.clear();
+  m_damageAll = false;
+
+  if (!m_shapeIndices.empty()) {
+    q.geometry(layer, nullptr, m_shapeVerts.data(), (int)m_shapeVerts.size(),
+               m_shapeIndices.data(), (int)m_shapeIndices.size());
+  }
+  for (size_t i = 0; i < m_widgets.size(); i++) {
+    const Widget& w = m_widgets[i];
+    if (w.kind != Kind::Button || !w.tex[0]) continue;
+
+    const Id list = listOf((Id)i);
+    const bool selected = list >= 0 &&
+      m_widgets[(size_t)list].children[(size_t)m_widgets[(size_t)list].selected] == (Id)i;
+    // Fetched per frame: the registry re-uploads after a renderer rebuild
+    SDL_Texture* tex = m_textures->get(w.tex[selected ? 1 : 0]);
+    if (!tex) continue;
+    if (selected) {
+      const SDL_Color mod = m_widgets[(size_t)list].mod;
+      SDL_SetTextureColorMod(tex, mod.r, mod.g, mod.b);
+    }
+    q.texture((uint8_t)(layer + 1), tex, nullptr, w.rect);
+  }
+  for (const TextBatch& b : m_text) {
+    if (b.indices.empty()) continue;
+    // Fetched per frame: the baked size may have been trimmed and rebuilt
+    SDL_Texture* tex = m_font->texture(b.px);
+    if (!tex) continue;
+    q.geometry((uint8_t)(layer + 1), tex, b.verts.data(), (int)b.verts.size(),
+               b.indices.data(), (int)b.indices.size());
+  }
+}
@@ -0,0 +1,142 @@
+// src/UiScreen.h
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+#include "RenderQueue.h"
+#include "SdfFont.h"
+#include "TextLayout.h"
+#include "TextureRegistry.h"
+
+// Retained-mode widgets for the menu-style screens.
+//
+// A scene builds its tree once (panels, labels, buttons, lists) and after
+// that only changes state: text, selection, highlight colour. Layout runs
+// when something that moves geometry is marked dirty (screen size, scale,
+// text), and its result is kept as pre-built batches: one untextured
+// geometry run for panel fills and outlines, and one glyph run per label
+// text size. Buttons are baked whole (box, marker and label) into a texture
+// per state, normal and selected, in the TextureRegistry. render() submits
+// all of that as-is, so a frame is a few RenderQueue::geometry calls plus
+// one copy per button, however many widgets there are. Selection only picks
+// the other texture; the highlight animation is that texture's colour mod.
+//
+// Sizes are design pixels, multiplied by the scale passed to resize().
+// Children stack top to bottom inside their parent's padding, `gap` apart,
+// centered horizontally. A width of 0 takes the parent's content width, a
+// height of 0 fits the content. The root (the first widget, parent -1) is
+// centered on screen.
+class UiScreen {
+public:
+  using Id = int; // -1 = none
+
+  // Fill, outline and a second outline `insetBy` inside it. Alpha 0 skips a
+  // part; the inset is blended onto the fill when built.
+  struct Box {
+    SDL_Color fill{ 0, 0, 0, 0 };
+    SDL_Color border{ 0, 0, 0, 0 };
+    SDL_Color inset{ 0, 0, 0, 0 };
+    float     insetBy = 4.f;
+  };
+
+  // The selected button of a list is baked with `highlight` as its fill and
+  // an optional square marker at its left edge.
+  struct ListStyle {
+    float     gap = 0.f;
+    SDL_Color highlight{ 255, 255, 255, 255 };
+    SDL_Color marker{ 0, 0, 0, 0 };
+  };
+
+  // `font` and `textures` must outlive this object
+  UiScreen(SdfFont& font, TextureRegistry& textures) : m_font(&font), m_textures(&textures) {}
+  ~UiScreen();
+
+  UiScreen(const UiScreen&) = delete;
+  UiScreen& operator=(const UiScreen&) = delete;
+
+  Id panel(Id parent, float w, float h, const Box& box, float padding, float gap);
+  Id label(Id parent, const char* text, float px, SDL_Color color, float h = 0.f);
+  Id list(Id parent, const ListStyle& style);
+  // Inside a list, buttons are its selectable items
+  Id button(Id parent, const char* text, float w, float h, float px,
+            SDL_Color color, const Box& box);
+
+  void setText(Id id, const char* text);
+
+  void select(Id list, int index);
+  void move(Id list, int delta); // wraps around
+  int  selected(Id list) const;
+  // Colour mod of the selected button's texture (white: as baked)
+  void setHighlightMod(Id list, SDL_Color mod);
+
+  // Also lays out again once the font has finished loading
+  void resize(int w, int h, float scale);
+
+  // Laid out screen rect (valid after the first render())
+  SDL_Rect bounds(Id id) const;
+
+  // Appends the areas that changed since the last render()
+  void damage(std::vector<SDL_Rect>& rects) const;
+
+  // Shapes on `layer`, buttons and text on `layer + 1`
+  void render(RenderQueue& q, uint8_t layer);
+
+private:
+  enum class Kind : uint8_t { Panel, Label, List, Button };
+
+  struct Widget {
+    Kind             kind = Kind::Panel;
+    Id               parent = -1;
+    std::vector<Id>  children;
+    float            w = 0.f, h = 0.f; // design size, 0 = auto
+    float            padding = 0.f;
+    float            gap = 0.f;
+    Box              box;
+    std::string      text;
+    float            px = 0.f;
+    SDL_Color        color{ 255, 255, 255, 255 };
+    ListStyle        list;
+    SDL_Color        mod{ 255, 255, 255, 255 }; // list: setHighlightMod()
+    int              selected = 0;
+    TextureRegistry::Handle tex[2] = { 0, 0 }; // button: normal, selected
+    SDL_FRect        rect{};  // screen pixels, from layout()
+    TextLayout       layout;  // copy: SdfFont's cache entry may be trimmed
+  };
+
+  struct TextBatch {
+    float                   px = 0.f;
+    std::vector<SDL_Vertex> verts;
+    std::vector<int>        indices;
+  };
+
+  Id   add(Id parent, Widget&& w);
+  void measure(Id id, float availW);
+  void place(Id id, float x, float y);
+  void layout();
+  void build();
+  void addBox(const SDL_FRect& r, const Box& box);
+  void addRect(const SDL_FRect& r, SDL_Color c);
+  void addOutline(const SDL_FRect& r, SDL_Color c);
+  void addText(const Widget& w, float x, float y);
+  Id   listOf(Id button) const; // -1 unless the button is a list item
+  void bakeButton(Id id, bool selected, uint32_t* argb, int w, int h) const;
+  void releaseTextures();
+  void damageWidget(Id id);
+
+  SdfFont*            m_font;
+  TextureRegistry*    m_textures;
+  std::vector<Widget> m_widgets;
+  int   m_w = 0, m_h = 0;
+  float m_scale = 1.f;
+  bool  m_fontReady = false; // when last laid out
+  bool  m_layoutDirty = true;
+
+  std::vector<SDL_Vertex> m_shapeVerts;
+  std::vector<int>        m_shapeIndices;
+  std::vector<TextBatch>  m_text;
+  std::vector<SDL_Rect>   m_damage;
+  bool                    m_damageAll = true;
+};
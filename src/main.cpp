@@ -1,20 +1,65 @@
 // src/main.cpp
 #include <SDL2/SDL.h>
-#include <SDL2/SDL_ttf.h>
 #include <cstdio>
+#include <cstring>
+#include <memory>
 
+#include "Assets.h"
+#include "FontCache.h"
 #include "Game.h"
+#include "GoldenFrames.h"
+#include "TrafficBench.h"
 
-int main(int, char**) {
-  if (SDL_Init(SDL_INIT_VIDEO) != 0) {
+// Embedded in the executable or in assets.pak (see Assets.h)
+static const char* FONT_ASSET = "fonts/DejaVuSans.ttf";
+
+// Prints how long the step since the previous call took; Game reports the
+// first present and the first interactive frame against the same launch time.
+static void startupStep(const char* step, Uint64& last) {
+  const Uint64 now = SDL_GetPerformanceCounter();
+  std::printf("startup: %-16s %6.1f ms\n", step,
+              (double)(now - last) * 1000.0 / (double)SDL_GetPerformanceFrequency());
+  last = now;
+}
+
+int main(int argc, char** argv) {
+  const Uint64 launch = SDL_GetPerformanceCounter(); // startup times count from here
+  Uint64 step = launch;
+
+  // game --golden [frames.txt]        compare offscreen frames with goldens
+  // game --golden-update [frames.txt] record them
+  const bool goldenUpdate = argc > 1 && std::strcmp(argv[1], "--golden-update") == 0;
+  const bool golden = goldenUpdate || (argc > 1 && std::strcmp(argv[1], "--golden") == 0);
+  const char* goldenPath = (golden && argc > 2) ? argv[2] : "golden/frames.txt";
+
+  // game --bench-traffic [cars]        time TrafficSim ticks (no SDL subsystems)
+  if (argc > 1 && std::strcmp(argv[1], "--bench-traffic") == 0) {
+    return runTrafficBench(argc > 2 ? SDL_atoi(argv[2]) : 1000);
+  }
+
+  // Only what the first frame needs. Golden runs render to a surface, so
+  // they need no video device. SDL_ttf starts with the first FontCache::open
+  // on the loader thread; audio or game controller support should likewise
+  // SDL_InitSubSystem at first use rather than here.
+  if (SDL_Init(golden ? 0 : SDL_INIT_VIDEO) != 0) {
     std::printf("SDL_Init failed: %s\n", SDL_GetError());
     return 1;
   }
+  startupStep("SDL_Init", step);
 
-  if (TTF_Init() != 0) {
-    std::printf("TTF_Init failed: %s\n", TTF_GetError());
+  // One mapping for every asset when the build ships assets.pak instead of
+  // embedding them, or GAME_ASSET_PAK names one
+  mountAssetPak();
+  startupStep("asset pak", step);
+
+  if (golden) {
+    int rc = 1;
+    {
+      FontCache fonts; // shuts SDL_ttf down again
+      if (fonts.open(FONT_ASSET)) rc = runGoldenFrames(fonts, goldenPath, "golden/diff", goldenUpdate);
+    }
     SDL_Quit();
-    return 1;
+    return rc;
   }
 
   SDL_Window* window = SDL_CreateWindow(
@@ -26,10 +71,10 @@ int main(int, char**) {
 
   if (!window) {
     std::printf("SDL_CreateWindow failed: %s\n", SDL_GetError());
-    TTF_Quit();
     SDL_Quit();
     return 1;
   }
+  startupStep("window", step);
 
   SDL_Renderer* renderer = SDL_CreateRenderer(
     window, -1, SDL_RENDERER_ACCELERATED | SDL_RENDERER_PRESENTVSYNC
@@ -38,31 +83,25 @@ int main(int, char**) {
   if (!renderer) {
     std::printf("SDL_CreateRenderer failed: %s\n", SDL_GetError());
     SDL_DestroyWindow(window);
-    TTF_Quit();
     SDL_Quit();
     return 1;
   }
+  startupStep("renderer", step);
 
-  // Load font (run from /Game so assets/... resolves)
-  TTF_Font* font = TTF_OpenFont("assets/fonts/DejaVuSans.ttf", 28);
-  if (!font) {
-    std::printf("TTF_OpenFont failed: %s\n", TTF_GetError());
-    SDL_DestroyRenderer(renderer);
-    SDL_DestroyWindow(window);
-    TTF_Quit();
-    SDL_Quit();
-    return 1;
-  }
+  // Game's loader opens it (timed there) and reads the one source face the
+  // distance field is built from. Its destructor ends SDL_ttf, so it goes
+  // before SDL_Quit.
+  auto fonts = std::make_unique<FontCache>();
 
   {
-    Game game(window, renderer, font);
+    Game game(window, renderer, *fonts, FONT_ASSET, launch);
+    startupStep("game setup", step);
     game.run();
   }
 
-  TTF_CloseFont(font);
+  fonts.reset();
   SDL_DestroyRenderer(renderer);
   SDL_DestroyWindow(window);
-  TTF_Quit();
   SDL_Quit();
   return 0;
 }
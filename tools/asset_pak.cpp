@@ -0,0 +1,195 @@
+// tools/asset_pak.cpp
+//
+// Build-time asset archiver (no SDL dependency, runs on the host).
+//
+// Usage:
+//   asset_pak --out <assets.pak> [--align N] [--dir <prefix>=<dir>]... [<name>=<file>]...
+//
+// Inputs are named like tools/embed_assets.cpp names them: every regular
+// file under each --dir as "<prefix>/<relative path>", single files under
+// their given name. The archive layout is documented in src/AssetPak.h;
+// payloads start at multiples of --align (default 16, a power of two).
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+const uint32_t VERSION = 1;
+const size_t HEADER_SIZE = 32;
+const size_t ENTRY_SIZE = 32;
+
+struct Input {
+  std::string name;
+  std::string path;
+  uint64_t hash = 0;
+  std::vector<uint8_t> data;
+};
+
+// Must match AssetPak::hashName
+uint64_t hashName(const std::string& name) {
+  uint64_t h = 1469598103934665603ull; // FNV-1a
+  for (unsigned char c : name) {
+    h ^= c;
+    h *= 1099511628211ull;
+  }
+  return h;
+}
+
+bool readFile(const std::string& path, std::vector<uint8_t>& out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return true;
+}
+
+bool writeIfChanged(const std::string& path, const std::vector<uint8_t>& bytes) {
+  std::vector<uint8_t> old;
+  if (readFile(path, old) && old == bytes) return true;
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) return false;
+  out.write((const char*)bytes.data(), (std::streamsize)bytes.size());
+  return (bool)out;
+}
+
+bool splitPair(const std::string& arg, std::string& key, std::string& value) {
+  const size_t eq = arg.find('=');
+  if (eq == std::string::npos || eq == 0 || eq + 1 == arg.size()) return false;
+  key = arg.substr(0, eq);
+  value = arg.substr(eq + 1);
+  return true;
+}
+
+bool addDir(const std::string& prefix, const std::string& dir, std::vector<Input>& inputs) {
+  std::error_code ec;
+  fs::recursive_directory_iterator it(dir, ec), end;
+  if (ec) return false;
+  for (; it != end; it.increment(ec)) {
+    if (ec) return false;
+    if (!it->is_regular_file()) continue;
+    Input in;
+    in.name = prefix + "/" + fs::relative(it->path(), dir).generic_string();
+    in.path = it->path().string();
+    inputs.push_back(std::move(in));
+  }
+  return true;
+}
+
+void put32(uint8_t* p, uint32_t v) {
+  for (int i = 0; i < 4; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+void put64(uint8_t* p, uint64_t v) {
+  for (int i = 0; i < 8; i++) p[i] = (uint8_t)(v >> (8 * i));
+}
+
+uint64_t alignUp(uint64_t v, uint64_t align) {
+  return (v + align - 1) & ~(align - 1);
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string out;
+  uint64_t align = 16;
+  std::vector<Input> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    std::string key, value;
+    if (arg == "--out" && i + 1 < argc) {
+      out = argv[++i];
+    } else if (arg == "--align" && i + 1 < argc) {
+      align = (uint64_t)std::strtoull(argv[++i], nullptr, 10);
+    } else if (arg == "--dir" && i + 1 < argc && splitPair(argv[i + 1], key, value)) {
+      i++;
+      if (!addDir(key, value, inputs)) {
+        std::fprintf(stderr, "asset_pak: cannot list %s\n", value.c_str());
+        return 1;
+      }
+    } else if (splitPair(arg, key, value)) {
+      Input in;
+      in.name = key;
+      in.path = value;
+      inputs.push_back(std::move(in));
+    } else {
+      out.clear();
+      break;
+    }
+  }
+
+  if (out.empty() || align == 0 || (align & (align - 1)) != 0) {
+    std::fprintf(stderr, "usage: asset_pak --out <assets.pak> [--align N] [--dir <prefix>=<dir>]... [<name>=<file>]...\n");
+    return 1;
+  }
+
+  for (Input& in : inputs) {
+    if (!readFile(in.path, in.data)) {
+      std::fprintf(stderr, "asset_pak: cannot read %s\n", in.path.c_str());
+      return 1;
+    }
+    in.hash = hashName(in.name);
+  }
+
+  // The index is binary searched by hash; equal hashes are ordered by name
+  std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) {
+    return a.hash != b.hash ? a.hash < b.hash : a.name < b.name;
+  });
+  for (size_t i = 1; i < inputs.size(); i++) {
+    if (inputs[i].name == inputs[i - 1].name) {
+      std::fprintf(stderr, "asset_pak: %s given twice\n", inputs[i].name.c_str());
+      return 1;
+    }
+  }
+
+  const uint64_t namesOffset = HEADER_SIZE + inputs.size() * ENTRY_SIZE;
+  uint64_t namesSize = 0;
+  for (const Input& in : inputs) namesSize += in.name.size();
+
+  std::vector<uint64_t> offsets(inputs.size());
+  uint64_t end = namesOffset + namesSize;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    offsets[i] = alignUp(end, align);
+    end = offsets[i] + inputs[i].data.size();
+  }
+
+  std::vector<uint8_t> pak((size_t)end, 0);
+  std::copy_n("GPAK", 4, pak.begin());
+  put32(&pak[4], VERSION);
+  put32(&pak[8], (uint32_t)inputs.size());
+  put32(&pak[12], (uint32_t)align);
+  put64(&pak[16], namesOffset);
+  put64(&pak[24], end);
+
+  uint64_t nameAt = 0;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const Input& in = inputs[i];
+    uint8_t* e = &pak[HEADER_SIZE + i * ENTRY_SIZE];
+    put64(e, in.hash);
+    put64(e + 8, offsets[i]);
+    put64(e + 16, in.data.size());
+    put32(e + 24, (uint32_t)nameAt);
+    put32(e + 28, (uint32_t)in.name.size());
+
+    std::copy(in.name.begin(), in.name.end(), pak.begin() + (long)(namesOffset + nameAt));
+    nameAt += in.name.size();
+    std::copy(in.data.begin(), in.data.end(), pak.begin() + (long)offsets[i]);
+  }
+
+  if (!writeIfChanged(out, pak)) {
+    std::fprintf(stderr, "asset_pak: cannot write %s\n", out.c_str());
+    return 1;
+  }
+
+  std::printf("asset_pak: %zu file(s), %llu bytes\n", inputs.size(), (unsigned long long)end);
+  return 0;
+}
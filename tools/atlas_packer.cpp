@@ -0,0 +1,343 @@
+// tools/atlas_packer.cpp
+//
+// Build-time sprite atlas packer (no SDL dependency, runs on the host).
+//
+// Usage:
+//   atlas_packer --out-dir <dir> --header <file.h> [--page-size N] sprites...
+//
+// Inputs are uncompressed .bmp files (24/32-bit; 32-bit BI_BITFIELDS in
+// any channel order) or raw .rgba files
+// (uint32 LE width, uint32 LE height, then width*height RGBA8 pixels).
+// The sprite name is the file name without extension.
+//
+// Outputs:
+//   <dir>/atlas_<n>.rgba   one raw RGBA page per atlas page (format as above)
+//   <file.h>               generated C++ table of sprite names + rectangles
+//
+// Sprites are shelf-packed tallest first onto pages of at most --page-size
+// (default 1024), each trimmed to a power of two. Every sprite gets a 1 px
+// border repeating its edge pixels, so linear filtering never bleeds
+// neighbors in.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace {
+
+struct Image {
+  std::string name;
+  int w = 0;
+  int h = 0;
+  std::vector<uint8_t> rgba; // w * h * 4
+};
+
+struct Placement {
+  int page = 0;
+  int x = 0;
+  int y = 0;
+};
+
+struct PageSize {
+  int w = 0;
+  int h = 0;
+};
+
+const int PAD = 1;
+
+bool readFile(const std::string& path, std::vector<uint8_t>& out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return true;
+}
+
+uint32_t le32(const uint8_t* p) {
+  return (uint32_t)p[0] | ((uint32_t)p[1] << 8) | ((uint32_t)p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+uint16_t le16(const uint8_t* p) {
+  return (uint16_t)(p[0] | (p[1] << 8));
+}
+
+void putLe32(std::vector<uint8_t>& out, uint32_t v) {
+  for (int i = 0; i < 4; i++) out.push_back((uint8_t)(v >> (8 * i)));
+}
+
+std::string baseName(const std::string& path) {
+  size_t slash = path.find_last_of("/\\");
+  std::string file = (slash == std::string::npos) ? path : path.substr(slash + 1);
+  size_t dot = file.find_last_of('.');
+  return (dot == std::string::npos) ? file : file.substr(0, dot);
+}
+
+bool endsWith(const std::string& s, const char* suffix) {
+  size_t n = std::strlen(suffix);
+  return s.size() >= n && s.compare(s.size() - n, n, suffix) == 0;
+}
+
+bool loadRaw(const std::vector<uint8_t>& data, Image& img) {
+  if (data.size() < 8) return false;
+  img.w = (int)le32(&data[0]);
+  img.h = (int)le32(&data[4]);
+  size_t bytes = (size_t)img.w * (size_t)img.h * 4;
+  if (img.w <= 0 || img.h <= 0 || data.size() < 8 + bytes) return false;
+  img.rgba.assign(data.begin() + 8, data.begin() + 8 + (long)bytes);
+  return true;
+}
+
+// One channel of a BI_BITFIELDS pixel: value = (pixel & mask) >> shift
+struct Channel {
+  uint32_t mask = 0;
+  int      shift = 0;
+  uint32_t max = 0; // mask >> shift
+
+  explicit Channel(uint32_t m) : mask(m) {
+    if (!mask) return;
+    while (!((mask >> shift) & 1u)) shift++;
+    max = mask >> shift;
+  }
+
+  // Contiguous run of 1..8 bits (wider channels would lose precision)
+  bool valid() const { return mask && (max & (max + 1)) == 0 && max <= 255; }
+
+  uint8_t get(uint32_t px, uint8_t fallback) const {
+    if (!mask) return fallback;
+    return (uint8_t)((((px & mask) >> shift) * 255u + max / 2) / max);
+  }
+};
+
+bool loadBmp(const std::vector<uint8_t>& data, Image& img) {
+  if (data.size() < 54 || data[0] != 'B' || data[1] != 'M') return false;
+
+  uint32_t offset = le32(&data[10]);
+  uint32_t headerSize = le32(&data[14]);
+  int32_t  w = (int32_t)le32(&data[18]);
+  int32_t  h = (int32_t)le32(&data[22]);
+  uint16_t bpp = le16(&data[28]);
+  uint32_t compression = le32(&data[30]);
+
+  // BI_RGB (24/32-bit, BGR(A) order) or 32-bit BI_BITFIELDS
+  if ((bpp != 24 && bpp != 32) || (compression != 0 && compression != 3)) return false;
+
+  // Bitfield masks follow a 40-byte header, or sit inside a V2+ header at
+  // the same place; only V3+ headers (56 bytes and up) carry an alpha mask.
+  Channel red(0x00FF0000u), green(0x0000FF00u), blue(0x000000FFu), alpha(bpp == 32 ? 0xFF000000u : 0u);
+  if (compression == 3) {
+    const bool hasAlpha = headerSize >= 56;
+    if (bpp != 32 || data.size() < (size_t)(hasAlpha ? 70 : 66)) return false;
+    red = Channel(le32(&data[54]));
+    green = Channel(le32(&data[58]));
+    blue = Channel(le32(&data[62]));
+    alpha = Channel(hasAlpha ? le32(&data[66]) : 0u);
+    const bool overlap = (red.mask & green.mask) || ((red.mask | green.mask) & blue.mask) ||
+                         ((red.mask | green.mask | blue.mask) & alpha.mask);
+    if (!red.valid() || !green.valid() || !blue.valid() || (alpha.mask && !alpha.valid()) || overlap) {
+      std::fprintf(stderr, "atlas_packer: unsupported BMP channel masks R %08x G %08x B %08x A %08x\n",
+        red.mask, green.mask, blue.mask, alpha.mask);
+      return false;
+    }
+  }
+
+  bool bottomUp = h > 0;
+  if (h < 0) h = -h;
+  if (w <= 0 || h <= 0) return false;
+
+  size_t stride = ((size_t)w * (bpp / 8) + 3) & ~(size_t)3;
+  if (data.size() < offset + stride * (size_t)h) return false;
+
+  img.w = w;
+  img.h = h;
+  img.rgba.resize((size_t)w * (size_t)h * 4);
+  for (int y = 0; y < h; y++) {
+    const uint8_t* row = &data[offset + stride * (size_t)(bottomUp ? h - 1 - y : y)];
+    for (int x = 0; x < w; x++) {
+      const uint8_t* src = row + (size_t)x * (bpp / 8);
+      const uint32_t px = (bpp == 32) ? le32(src) : ((uint32_t)src[2] << 16 | (uint32_t)src[1] << 8 | src[0]);
+      uint8_t* dst = &img.rgba[((size_t)y * w + x) * 4];
+      dst[0] = red.get(px, 0);
+      dst[1] = green.get(px, 0);
+      dst[2] = blue.get(px, 0);
+      dst[3] = alpha.get(px, 255);
+    }
+  }
+  return true;
+}
+
+bool loadImage(const std::string& path, Image& img) {
+  std::vector<uint8_t> data;
+  if (!readFile(path, data)) return false;
+
+  img.name = baseName(path);
+  if (endsWith(path, ".rgba")) return loadRaw(data, img);
+  if (endsWith(path, ".bmp"))  return loadBmp(data, img);
+  return false;
+}
+
+// Shelf packer: fills rows left to right, opens a new shelf when a row is
+// full and a new page when the page is full.
+int nextPow2(int v) {
+  int p = 1;
+  while (p < v) p <<= 1;
+  return p;
+}
+
+// Pages are trimmed to the power-of-two size that holds what landed on them.
+bool pack(const std::vector<Image>& images, const std::vector<size_t>& order,
+          int pageSize, std::vector<Placement>& out, std::vector<PageSize>& pages) {
+  out.assign(images.size(), Placement{});
+  pages.clear();
+  if (!images.empty()) pages.push_back(PageSize{});
+
+  int page = 0, x = 0, y = 0, shelfH = 0;
+  for (size_t idx : order) {
+    const Image& img = images[idx];
+    int w = img.w + 2 * PAD;
+    int h = img.h + 2 * PAD;
+    if (w > pageSize || h > pageSize) {
+      std::fprintf(stderr, "atlas_packer: %s (%dx%d) does not fit a %d page\n",
+                   img.name.c_str(), img.w, img.h, pageSize);
+      return false;
+    }
+
+    if (x + w > pageSize) { x = 0; y += shelfH; shelfH = 0; }
+    if (y + h > pageSize) { page++; x = 0; y = 0; shelfH = 0; pages.push_back(PageSize{}); }
+
+    out[idx] = Placement{ page, x + PAD, y + PAD };
+    x += w;
+    shelfH = std::max(shelfH, h);
+    pages[page].w = std::max(pages[page].w, nextPow2(x));
+    pages[page].h = std::max(pages[page].h, nextPow2(y + shelfH));
+  }
+  return true;
+}
+
+void blit(std::vector<uint8_t>& page, int pageW, const Image& img, const Placement& p) {
+  // Copy with a 1 px clamped border
+  for (int y = -PAD; y < img.h + PAD; y++) {
+    int sy = std::max(0, std::min(y, img.h - 1));
+    for (int x = -PAD; x < img.w + PAD; x++) {
+      int sx = std::max(0, std::min(x, img.w - 1));
+      const uint8_t* src = &img.rgba[((size_t)sy * img.w + sx) * 4];
+      uint8_t* dst = &page[((size_t)(p.y + y) * pageW + (p.x + x)) * 4];
+      std::memcpy(dst, src, 4);
+    }
+  }
+}
+
+bool writeIfChanged(const std::string& path, const std::string& text) {
+  std::vector<uint8_t> old;
+  if (readFile(path, old) && std::string(old.begin(), old.end()) == text) return true;
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) return false;
+  out << text;
+  return (bool)out;
+}
+
+std::string makeHeader(const std::vector<Image>& images, const std::vector<Placement>& places,
+                       int pageCount) {
+  std::ostringstream h;
+  h << "// Generated by tools/atlas_packer.cpp -- do not edit.\n"
+    << "#pragma once\n\n"
+    << "namespace atlasdata {\n\n"
+    << "struct SpriteRect {\n"
+    << "  const char* name;\n"
+    << "  int page;\n"
+    << "  int x, y, w, h;\n"
+    << "};\n\n"
+    << "constexpr int PAGE_COUNT = " << pageCount << ";\n"
+    << "constexpr int SPRITE_COUNT = " << images.size() << ";\n\n";
+
+  // Keep arrays non-empty so the header always compiles
+  h << "constexpr const char* PAGES[] = {\n";
+  for (int i = 0; i < pageCount; i++) h << "  \"atlas_" << i << ".rgba\",\n";
+  if (pageCount == 0) h << "  nullptr,\n";
+  h << "};\n\n";
+
+  h << "constexpr SpriteRect SPRITES[] = {\n";
+  for (size_t i = 0; i < images.size(); i++) {
+    const Placement& p = places[i];
+    h << "  { \"" << images[i].name << "\", " << p.page << ", "
+      << p.x << ", " << p.y << ", " << images[i].w << ", " << images[i].h << " },\n";
+  }
+  if (images.empty()) h << "  { nullptr, 0, 0, 0, 0, 0 },\n";
+  h << "};\n\n"
+    << "} // namespace atlasdata\n";
+  return h.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string outDir, header;
+  int pageSize = 1024;
+  std::vector<std::string> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    if (arg == "--out-dir" && i + 1 < argc)        outDir = argv[++i];
+    else if (arg == "--header" && i + 1 < argc)    header = argv[++i];
+    else if (arg == "--page-size" && i + 1 < argc) pageSize = std::atoi(argv[++i]);
+    else inputs.push_back(arg);
+  }
+
+  if (outDir.empty() || header.empty() || pageSize <= 0) {
+    std::fprintf(stderr, "usage: atlas_packer --out-dir <dir> --header <file.h> [--page-size N] sprites...\n");
+    return 1;
+  }
+
+  std::vector<Image> images;
+  for (const auto& path : inputs) {
+    Image img;
+    if (!loadImage(path, img)) {
+      std::fprintf(stderr, "atlas_packer: cannot read %s (expected .bmp or .rgba)\n", path.c_str());
+      return 1;
+    }
+    images.push_back(std::move(img));
+  }
+
+  // Deterministic output: names sorted, packing tallest first
+  std::sort(images.begin(), images.end(), [](const Image& a, const Image& b) { return a.name < b.name; });
+  std::vector<size_t> order(images.size());
+  for (size_t i = 0; i < order.size(); i++) order[i] = i;
+  std::stable_sort(order.begin(), order.end(), [&](size_t a, size_t b) { return images[a].h > images[b].h; });
+
+  std::vector<Placement> places;
+  std::vector<PageSize> pages;
+  if (!pack(images, order, pageSize, places, pages)) return 1;
+  const int pageCount = (int)pages.size();
+
+  for (int page = 0; page < pageCount; page++) {
+    const PageSize& size = pages[page];
+    std::vector<uint8_t> pixels((size_t)size.w * size.h * 4, 0);
+    for (size_t i = 0; i < images.size(); i++) {
+      if (places[i].page == page) blit(pixels, size.w, images[i], places[i]);
+    }
+
+    std::vector<uint8_t> file;
+    putLe32(file, (uint32_t)size.w);
+    putLe32(file, (uint32_t)size.h);
+    file.insert(file.end(), pixels.begin(), pixels.end());
+
+    std::string path = outDir + "/atlas_" + std::to_string(page) + ".rgba";
+    if (!writeIfChanged(path, std::string(file.begin(), file.end()))) {
+      std::fprintf(stderr, "atlas_packer: cannot write %s\n", path.c_str());
+      return 1;
+    }
+  }
+
+  if (!writeIfChanged(header, makeHeader(images, places, pageCount))) {
+    std::fprintf(stderr, "atlas_packer: cannot write %s\n", header.c_str());
+    return 1;
+  }
+
+  std::printf("atlas_packer: %zu sprites on %d page(s)\n", images.size(), pageCount);
+  return 0;
+}
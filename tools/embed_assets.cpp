@@ -0,0 +1,156 @@
+// tools/embed_assets.cpp
+//
+// Build-time asset embedder (no SDL dependency, runs on the host).
+//
+// Usage:
+//   embed_assets --out <file.cpp> [--dir <prefix>=<dir>]... [<name>=<file>]...
+//
+// Every regular file under each --dir (recursively) is embedded as
+// "<prefix>/<relative path>", single files under their given name. The
+// output defines embedded::FILES (see src/EmbeddedAssets.h): one read-only
+// byte array per file and an index sorted by name, so the game finds an
+// asset with a binary search and uses the bytes in place.
+
+#include <algorithm>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+namespace {
+
+struct Input {
+  std::string name; // as looked up at runtime, '/' separated
+  std::string path;
+};
+
+bool readFile(const std::string& path, std::vector<uint8_t>& out) {
+  std::ifstream in(path, std::ios::binary);
+  if (!in) return false;
+  out.assign(std::istreambuf_iterator<char>(in), std::istreambuf_iterator<char>());
+  return true;
+}
+
+bool writeIfChanged(const std::string& path, const std::string& text) {
+  std::vector<uint8_t> old;
+  if (readFile(path, old) && std::string(old.begin(), old.end()) == text) return true;
+
+  std::ofstream out(path, std::ios::binary | std::ios::trunc);
+  if (!out) return false;
+  out << text;
+  return (bool)out;
+}
+
+bool splitPair(const std::string& arg, std::string& key, std::string& value) {
+  const size_t eq = arg.find('=');
+  if (eq == std::string::npos || eq == 0 || eq + 1 == arg.size()) return false;
+  key = arg.substr(0, eq);
+  value = arg.substr(eq + 1);
+  return true;
+}
+
+bool addDir(const std::string& prefix, const std::string& dir, std::vector<Input>& inputs) {
+  std::error_code ec;
+  fs::recursive_directory_iterator it(dir, ec), end;
+  if (ec) return false;
+  for (; it != end; it.increment(ec)) {
+    if (ec) return false;
+    if (!it->is_regular_file()) continue;
+    const std::string rel = fs::relative(it->path(), dir).generic_string();
+    inputs.push_back(Input{ prefix + "/" + rel, it->path().string() });
+  }
+  return true;
+}
+
+std::string makeSource(const std::vector<Input>& inputs, const std::vector<std::vector<uint8_t>>& data) {
+  std::ostringstream s;
+  s << "// Generated by tools/embed_assets.cpp -- do not edit.\n"
+    << "#include \"EmbeddedAssets.h\"\n\n"
+    << "namespace embedded {\n\n"
+    << "namespace {\n\n";
+
+  for (size_t i = 0; i < inputs.size(); i++) {
+    const std::vector<uint8_t>& bytes = data[i];
+    s << "// " << inputs[i].name << "\n"
+      << "alignas(16) const unsigned char file" << i << "[] = {";
+    for (size_t b = 0; b < bytes.size(); b++) {
+      s << ((b % 24 == 0) ? "\n  " : "") << (unsigned)bytes[b] << ",";
+    }
+    if (bytes.empty()) s << " 0"; // arrays can't be empty; size stays 0
+    s << "\n};\n\n";
+  }
+
+  s << "} // namespace\n\n"
+    << "const File FILES[] = {\n";
+  for (size_t i = 0; i < inputs.size(); i++) {
+    s << "  { \"" << inputs[i].name << "\", file" << i << ", " << data[i].size() << "u },\n";
+  }
+  if (inputs.empty()) s << "  { \"\", nullptr, 0u },\n";
+  s << "};\n\n"
+    << "const int FILE_COUNT = " << inputs.size() << ";\n\n"
+    << "} // namespace embedded\n";
+  return s.str();
+}
+
+} // namespace
+
+int main(int argc, char** argv) {
+  std::string out;
+  std::vector<Input> inputs;
+
+  for (int i = 1; i < argc; i++) {
+    std::string arg = argv[i];
+    std::string key, value;
+    if (arg == "--out" && i + 1 < argc) {
+      out = argv[++i];
+    } else if (arg == "--dir" && i + 1 < argc && splitPair(argv[i + 1], key, value)) {
+      i++;
+      if (!addDir(key, value, inputs)) {
+        std::fprintf(stderr, "embed_assets: cannot list %s\n", value.c_str());
+        return 1;
+      }
+    } else if (splitPair(arg, key, value)) {
+      inputs.push_back(Input{ key, value });
+    } else {
+      out.clear();
+      break;
+    }
+  }
+
+  if (out.empty()) {
+    std::fprintf(stderr, "usage: embed_assets --out <file.cpp> [--dir <prefix>=<dir>]... [<name>=<file>]...\n");
+    return 1;
+  }
+
+  // The runtime index is binary searched with strcmp order
+  std::sort(inputs.begin(), inputs.end(), [](const Input& a, const Input& b) { return a.name < b.name; });
+  for (size_t i = 1; i < inputs.size(); i++) {
+    if (inputs[i].name == inputs[i - 1].name) {
+      std::fprintf(stderr, "embed_assets: %s given twice\n", inputs[i].name.c_str());
+      return 1;
+    }
+  }
+
+  std::vector<std::vector<uint8_t>> data(inputs.size());
+  size_t total = 0;
+  for (size_t i = 0; i < inputs.size(); i++) {
+    if (!readFile(inputs[i].path, data[i])) {
+      std::fprintf(stderr, "embed_assets: cannot read %s\n", inputs[i].path.c_str());
+      return 1;
+    }
+    total += data[i].size();
+  }
+
+  if (!writeIfChanged(out, makeSource(inputs, data))) {
+    std::fprintf(stderr, "embed_assets: cannot write %s\n", out.c_str());
+    return 1;
+  }
+
+  std::printf("embed_assets: %zu file(s), %zu bytes\n", inputs.size(), total);
+  return 0;
+}